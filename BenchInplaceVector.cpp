@@ -0,0 +1,1187 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  BenchInplaceVector.cpp
+//
+//  Copyright  Pete Isensee (PKIsensee@msn.com).
+//  All rights reserved worldwide.
+//
+//  Permission to copy, modify, reproduce or redistribute this source code is
+//  granted provided the above copyright notice is retained in the resulting 
+//  source code.
+// 
+//  This software is provided "as is" and without any express or implied
+//  warranties.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <format>
+#include <forward_list>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <version>
+
+#if defined( __cpp_lib_flat_map )
+#include <flat_map>
+#endif
+
+#include <intrin.h>
+
+#include "inplace_vector.h"
+
+#if __has_include( "inplace_flat_map.h" )
+#include "inplace_flat_map.h"
+#else
+#error "inplace_flat_map.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_mpmc_queue.h" )
+#include "inplace_mpmc_queue.h"
+#else
+#error "inplace_mpmc_queue.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_slot_vector.h" )
+#include "inplace_slot_vector.h"
+#else
+#error "inplace_slot_vector.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_soa_vector.h" )
+#include "inplace_soa_vector.h"
+#else
+#error "inplace_soa_vector.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_spsc_ring.h" )
+#include "inplace_spsc_ring.h"
+#else
+#error "inplace_spsc_ring.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_vector_pool.h" )
+#include "inplace_vector_pool.h"
+#else
+#error "inplace_vector_pool.h not found; it belongs in the InplaceVector project"
+#endif
+
+using namespace PKIsensee;
+using namespace std::literals;
+
+// Build and run the Release configuration; Debug timings are meaningless.
+// To compare contract-check costs, rebuild with PKISENSEE_CONTRACT_MODE defined as
+// off, trap, log or throw_exception and compare the "checked access" rows.
+
+namespace { // anonymous
+
+constexpr size_t kElementsPerSample = 4096; // elements touched per timed sample
+constexpr size_t kSamples = 15;             // best of kSamples is reported
+
+// Keeps the optimizer from discarding benchmark results
+volatile size_t gSink = 0;
+
+template <typename Container>
+void Consume( const Container& c )
+{
+  gSink = c.size();
+  if constexpr ( requires { c.data(); } )
+    gSink = reinterpret_cast<uintptr_t>( c.data() );
+  else
+    gSink = reinterpret_cast<uintptr_t>( &c );
+}
+
+// Non-trival object for benchmarking; same members as M in TestInplaceVector.cpp, but
+// the destructor doesn't overwrite the state, so the rows time only the real cleanup
+class M
+{
+public:
+  M() : M( "Initialized", 42, 123.456f )
+  {
+  }
+
+  M( const std::string& s, int i, float f ) :
+    s_{ s },
+    v_{ i, i },
+    p_{ new float{ f } }
+  {
+  }
+
+  M( const M& ) = default;
+  M( M&& ) = default;
+  M& operator=( const M& ) = default;
+  M& operator=( M&& ) = default;
+  ~M() = default;
+
+private:
+  std::string s_;
+  std::vector<int> v_;
+  std::shared_ptr<float> p_;
+};
+
+class MR : public M // M opted in to bitwise relocation
+{
+public:
+  using M::M;
+};
+
+} // anonymous namespace
+
+// Debug iterator checking gives every std::string and std::vector a proxy that points
+// back at the container, so M's members are only relocatable without it. Release
+// builds, the only ones worth timing, have _ITERATOR_DEBUG_LEVEL 0.
+#if _ITERATOR_DEBUG_LEVEL == 0
+namespace PKIsensee
+{
+template <>
+struct is_trivially_relocatable<MR> : std::true_type {};
+}
+#endif
+
+namespace { // anonymous
+
+template <typename T>
+T MakeValue( size_t i )
+{
+  if constexpr ( std::is_base_of_v<M, T> )
+    return T{ "m", static_cast<int>( i ), static_cast<float>( i ) };
+  else
+    return static_cast<T>( i );
+}
+
+template <typename Container>
+void Emplace( Container& c, size_t i )
+{
+  if constexpr ( std::is_base_of_v<M, typename Container::value_type> )
+    c.emplace_back( "m", static_cast<int>( i ), static_cast<float>( i ) );
+  else
+    c.emplace_back( static_cast<typename Container::value_type>( i ) );
+}
+
+template <typename T>
+constexpr std::string_view TypeName()
+{
+  if constexpr ( std::is_same_v<T, MR> )
+    return "MR"sv;
+  else if constexpr ( std::is_same_v<T, M> )
+    return "M"sv;
+  else if constexpr ( std::is_same_v<T, double> )
+    return "dbl"sv;
+  else
+    return "int"sv;
+}
+
+struct Result
+{
+  double nsPerOp = 0.0;
+  double cyclesPerOp = 0.0;
+};
+
+// Times op( a[i], b[i] ) over a batch of container pairs. setup( a[i], b[i] ) runs
+// untimed before every sample. Batching keeps the timer overhead negligible at small N.
+// Containers live on the heap; inplace_vector<M, 4096> is too large for the stack.
+template <typename Container, typename Setup, typename Op>
+Result Measure( size_t n, size_t opsPerContainer, Setup&& setup, Op&& op )
+{
+  const size_t batch = std::max( size_t{ 1 }, kElementsPerSample / n );
+  std::vector<Container> a( batch );
+  std::vector<Container> b( batch );
+
+  auto bestNs = std::numeric_limits<double>::max();
+  auto bestCycles = std::numeric_limits<double>::max();
+  for ( size_t sample = 0; sample < kSamples; ++sample )
+  {
+    for ( size_t i = 0; i < batch; ++i )
+      setup( a[ i ], b[ i ] );
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto startCycles = __rdtsc();
+    for ( size_t i = 0; i < batch; ++i )
+      op( a[ i ], b[ i ] );
+    const auto endCycles = __rdtsc();
+    const auto end = std::chrono::steady_clock::now();
+
+    for ( size_t i = 0; i < batch; ++i )
+      Consume( b[ i ] );
+
+    const auto ns = std::chrono::duration<double, std::nano>( end - start ).count();
+    bestNs = std::min( bestNs, ns );
+    bestCycles = std::min( bestCycles, static_cast<double>( endCycles - startCycles ) );
+  }
+
+  const auto ops = static_cast<double>( batch * std::max( size_t{ 1 }, opsPerContainer ) );
+  return { bestNs / ops, bestCycles / ops };
+}
+
+// Times op() with no per-sample setup; op performs opsPerSample operations
+template <typename Op>
+Result MeasureLoop( size_t opsPerSample, Op&& op )
+{
+  auto bestNs = std::numeric_limits<double>::max();
+  auto bestCycles = std::numeric_limits<double>::max();
+  for ( size_t sample = 0; sample < kSamples; ++sample )
+  {
+    const auto start = std::chrono::steady_clock::now();
+    const auto startCycles = __rdtsc();
+    op();
+    const auto endCycles = __rdtsc();
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto ns = std::chrono::duration<double, std::nano>( end - start ).count();
+    bestNs = std::min( bestNs, ns );
+    bestCycles = std::min( bestCycles, static_cast<double>( endCycles - startCycles ) );
+  }
+
+  const auto ops = static_cast<double>( std::max( size_t{ 1 }, opsPerSample ) );
+  return { bestNs / ops, bestCycles / ops };
+}
+
+// Times one transfer across threadCount threads; worker( t ) runs on thread t. The
+// threads start and park on a barrier before the clock starts and are joined after it
+// stops, so thread creation and teardown stay out of the figures. setup() runs untimed
+// before each sample.
+template <typename Setup, typename Worker>
+Result MeasureThreads( size_t opsPerSample, size_t threadCount, Setup&& setup, Worker&& worker )
+{
+  auto bestNs = std::numeric_limits<double>::max();
+  auto bestCycles = std::numeric_limits<double>::max();
+  for ( size_t sample = 0; sample < kSamples; ++sample )
+  {
+    setup();
+    std::barrier sync( static_cast<ptrdiff_t>( threadCount + 1 ) );
+    std::vector<std::thread> threads;
+    for ( size_t t = 0; t < threadCount; ++t )
+    {
+      threads.emplace_back( [&, t]()
+        {
+          sync.arrive_and_wait(); // start
+          worker( t );
+          sync.arrive_and_wait(); // done
+        } );
+    }
+
+    sync.arrive_and_wait(); // every thread is running
+    const auto start = std::chrono::steady_clock::now();
+    const auto startCycles = __rdtsc();
+    sync.arrive_and_wait(); // every worker has finished
+    const auto endCycles = __rdtsc();
+    const auto end = std::chrono::steady_clock::now();
+    for ( auto& thread : threads )
+      thread.join();
+
+    const auto ns = std::chrono::duration<double, std::nano>( end - start ).count();
+    bestNs = std::min( bestNs, ns );
+    bestCycles = std::min( bestCycles, static_cast<double>( endCycles - startCycles ) );
+  }
+
+  const auto ops = static_cast<double>( std::max( size_t{ 1 }, opsPerSample ) );
+  return { bestNs / ops, bestCycles / ops };
+}
+
+void Report( std::string_view op, std::string_view type, std::string_view container,
+             size_t n, const Result& result )
+{
+  std::cout << std::format( "{:<22}{:<5}{:<18}{:>6}{:>12.2f}{:>12.2f}\n",
+                            op, type, container, n, result.nsPerOp, result.cyclesPerOp );
+}
+
+template <typename Container>
+constexpr std::string_view ContainerName()
+{
+  using T = typename Container::value_type;
+  if constexpr ( std::is_same_v<Container, std::vector<T>> )
+    return "std::vector"sv;
+  else
+    return "inplace_vector"sv;
+}
+
+// Operations common to inplace_vector and std::vector. The vector is reserved up front
+// so it never reallocates during a timed sample.
+template <typename Container, size_t N>
+void RunSequenceBenchmarks()
+{
+  using T = typename Container::value_type;
+  constexpr auto type = TypeName<T>();
+  constexpr auto name = ContainerName<Container>();
+  constexpr auto half = N / 2;
+
+  std::vector<T> src;
+  for ( size_t i = 0; i < N; ++i )
+    src.push_back( MakeValue<T>( i ) );
+  const T value = MakeValue<T>( N );
+
+  auto reset = [&]( Container& c, size_t count )
+    {
+      c.clear();
+      c.reserve( N );
+      c.insert( c.end(), src.begin(), src.begin() + static_cast<ptrdiff_t>( count ) );
+    };
+
+  auto fillSetup = [&]( Container& a, Container& b )
+    {
+      reset( a, N );
+      b.clear();
+      b.reserve( N );
+    };
+
+  auto insertSetup = [&]( Container&, Container& b ) { reset( b, half ); };
+  auto eraseSetup = [&]( Container&, Container& b ) { reset( b, N ); };
+  constexpr auto shiftOps = N - half;
+
+  Report( "push_back", type, name, N, Measure<Container>( N, N, fillSetup,
+    [&]( Container&, Container& b )
+    {
+      for ( size_t i = 0; i < N; ++i )
+        b.push_back( value );
+    } ) );
+
+  Report( "emplace_back", type, name, N, Measure<Container>( N, N, fillSetup,
+    [&]( Container&, Container& b )
+    {
+      for ( size_t i = 0; i < N; ++i )
+        Emplace( b, i );
+    } ) );
+
+  if constexpr ( !std::is_same_v<Container, std::vector<T>> )
+  {
+    Report( "unchecked_push_back", type, name, N, Measure<Container>( N, N, fillSetup,
+      [&]( Container&, Container& b )
+      {
+        for ( size_t i = 0; i < N; ++i )
+          b.unchecked_push_back( value );
+      } ) );
+  }
+
+  if constexpr ( !std::is_same_v<Container, std::vector<T>> )
+  {
+    Report( "append_n", type, name, N, Measure<Container>( N, N, fillSetup,
+      [&]( Container&, Container& b )
+      {
+        b.append_n( N, []( size_t i ) { return MakeValue<T>( i ); } );
+      } ) );
+  }
+
+  Report( "push_back generated", type, name, N, Measure<Container>( N, N, fillSetup,
+    [&]( Container&, Container& b )
+    {
+      for ( size_t i = 0; i < N; ++i )
+        b.push_back( MakeValue<T>( i ) );
+    } ) );
+
+  if constexpr ( !std::is_same_v<Container, std::vector<T>> )
+  {
+    // operator[], front(), back() and pop_back() all carry a contract check
+    Report( "checked access", type, name, N, Measure<Container>( N, N, eraseSetup,
+      []( Container&, Container& b )
+      {
+        size_t touched = 0;
+        for ( size_t i = 0; i < N; ++i )
+          touched += ( &b[ i ] == &b.back() ) ? 1u : 0u;
+        gSink = touched + reinterpret_cast<uintptr_t>( &b.front() );
+        while ( !b.empty() )
+          b.pop_back();
+      } ) );
+  }
+
+  Report( "insert front", type, name, N, Measure<Container>( N, shiftOps, insertSetup,
+    [&]( Container&, Container& b )
+    {
+      for ( size_t i = 0; i < shiftOps; ++i )
+        b.insert( b.begin(), value );
+    } ) );
+
+  Report( "insert middle", type, name, N, Measure<Container>( N, shiftOps, insertSetup,
+    [&]( Container&, Container& b )
+    {
+      for ( size_t i = 0; i < shiftOps; ++i )
+        b.insert( b.begin() + static_cast<ptrdiff_t>( b.size() / 2 ), value );
+    } ) );
+
+  Report( "insert back", type, name, N, Measure<Container>( N, shiftOps, insertSetup,
+    [&]( Container&, Container& b )
+    {
+      for ( size_t i = 0; i < shiftOps; ++i )
+        b.insert( b.end(), value );
+    } ) );
+
+  Report( "erase front", type, name, N, Measure<Container>( N, shiftOps, eraseSetup,
+    [&]( Container&, Container& b )
+    {
+      for ( size_t i = 0; i < shiftOps; ++i )
+        b.erase( b.begin() );
+    } ) );
+
+  Report( "erase middle", type, name, N, Measure<Container>( N, shiftOps, eraseSetup,
+    [&]( Container&, Container& b )
+    {
+      for ( size_t i = 0; i < shiftOps; ++i )
+        b.erase( b.begin() + static_cast<ptrdiff_t>( b.size() / 2 ) );
+    } ) );
+
+  Report( "erase back", type, name, N, Measure<Container>( N, shiftOps, eraseSetup,
+    [&]( Container&, Container& b )
+    {
+      for ( size_t i = 0; i < shiftOps; ++i )
+        b.erase( b.end() - 1 );
+    } ) );
+
+  if constexpr ( !std::is_same_v<Container, std::vector<T>> )
+  {
+    Report( "erase_unordered mid", type, name, N, Measure<Container>( N, shiftOps, eraseSetup,
+      [&]( Container&, Container& b )
+      {
+        for ( size_t i = 0; i < shiftOps; ++i )
+          b.erase_unordered( b.begin() + static_cast<ptrdiff_t>( b.size() / 2 ) );
+      } ) );
+  }
+
+  // Removes every fourth element
+  auto everyFourth = [n = size_t{ 0 }]( const T& ) mutable { return n++ % 4 == 0; };
+  Report( "erase_if", type, name, N, Measure<Container>( N, N, eraseSetup,
+    [&]( Container&, Container& b )
+    {
+      erase_if( b, everyFourth );
+    } ) );
+
+  if constexpr ( !std::is_same_v<Container, std::vector<T>> )
+  {
+    Report( "erase_if_unordered", type, name, N, Measure<Container>( N, N, eraseSetup,
+      [&]( Container&, Container& b )
+      {
+        erase_if_unordered( b, everyFourth );
+      } ) );
+  }
+
+  Report( "append_range", type, name, N, Measure<Container>( N, N, fillSetup,
+    [&]( Container&, Container& b )
+    {
+      b.append_range( src );
+    } ) );
+
+  Report( "copy", type, name, N, Measure<Container>( N, N, fillSetup,
+    []( Container& a, Container& b )
+    {
+      b = a;
+    } ) );
+
+  Report( "move", type, name, N, Measure<Container>( N, N, fillSetup,
+    []( Container& a, Container& b )
+    {
+      b = std::move( a );
+    } ) );
+
+  Report( "swap", type, name, N, Measure<Container>( N, N,
+    [&]( Container& a, Container& b )
+    {
+      reset( a, N );
+      reset( b, N );
+    },
+    []( Container& a, Container& b )
+    {
+      a.swap( b );
+    } ) );
+}
+
+// std::array has no size of its own; "push_back" is assignment into the next slot
+template <typename T, size_t N>
+void RunArrayBenchmarks()
+{
+  using Container = std::array<T, N>;
+  constexpr auto type = TypeName<T>();
+  constexpr auto name = "std::array"sv;
+
+  const T value = MakeValue<T>( N );
+  auto fill = []( Container& c )
+    {
+      for ( size_t i = 0; i < N; ++i )
+        c[ i ] = MakeValue<T>( i );
+    };
+  auto pairSetup = [&]( Container& a, Container& b )
+    {
+      fill( a );
+      fill( b );
+    };
+
+  Report( "push_back", type, name, N, Measure<Container>( N, N, pairSetup,
+    [&]( Container&, Container& b )
+    {
+      for ( size_t i = 0; i < N; ++i )
+        b[ i ] = value;
+    } ) );
+
+  Report( "copy", type, name, N, Measure<Container>( N, N, pairSetup,
+    []( Container& a, Container& b )
+    {
+      b = a;
+    } ) );
+
+  Report( "move", type, name, N, Measure<Container>( N, N, pairSetup,
+    []( Container& a, Container& b )
+    {
+      b = std::move( a );
+    } ) );
+
+  Report( "swap", type, name, N, Measure<Container>( N, N, pairSetup,
+    []( Container& a, Container& b )
+    {
+      a.swap( b );
+    } ) );
+}
+
+template <typename T, size_t N>
+void RunBenchmarks()
+{
+  RunSequenceBenchmarks<inplace_vector<T, N>, N>();
+  RunSequenceBenchmarks<std::vector<T>, N>();
+  RunArrayBenchmarks<T, N>();
+}
+
+template <typename T, size_t... Ns>
+void RunAllCapacities( std::index_sequence<Ns...> )
+{
+  ( RunBenchmarks<T, Ns>(), ... );
+}
+
+using Capacities = std::index_sequence<4, 16, 64, 256, 1024, 4096>;
+
+// Inserts N/2 elements into the middle of a half-full container. A sized range is one
+// capacity check and a single shift of the tail; the loop row is the per-element
+// insert it replaces. The forward_list is forward but not sized, so its length is
+// measured before the shift.
+template <typename Container, size_t N>
+void RunInsertRangeBenchmarks()
+{
+  using T = typename Container::value_type;
+  constexpr auto type = TypeName<T>();
+  constexpr auto name = ContainerName<Container>();
+  constexpr auto half = N / 2;
+
+  std::vector<T> src;
+  for ( size_t i = 0; i < N; ++i )
+    src.push_back( MakeValue<T>( i ) );
+  const auto first = src.begin();
+  const auto last = src.begin() + static_cast<ptrdiff_t>( half );
+  const std::forward_list<T> unsized( first, last );
+
+  auto setup = [&]( Container&, Container& b )
+    {
+      b.clear();
+      b.reserve( N );
+      b.insert( b.end(), first, last );
+    };
+  auto middle = []( Container& c ) { return c.begin() + static_cast<ptrdiff_t>( c.size() / 2 ); };
+
+  Report( "insert range middle", type, name, N, Measure<Container>( N, half, setup,
+    [&]( Container&, Container& b )
+    {
+      b.insert( middle( b ), first, last );
+    } ) );
+
+  Report( "insert range mid fwd", type, name, N, Measure<Container>( N, half, setup,
+    [&]( Container&, Container& b )
+    {
+      b.insert( middle( b ), unsized.begin(), unsized.end() );
+    } ) );
+
+  Report( "insert loop middle", type, name, N, Measure<Container>( N, half, setup,
+    [&]( Container&, Container& b )
+    {
+      auto pos = middle( b );
+      for ( auto it = first; it != last; ++it )
+        pos = b.insert( pos, *it ) + 1;
+    } ) );
+}
+
+// Acquire kLiveVectors vectors, fill each to a varying size, then release them all.
+// Sizes cycle through [1, N] so most instances are far below worst-case capacity.
+template <size_t N>
+void RunPoolBenchmarks()
+{
+  constexpr size_t kLiveVectors = 256;
+  auto sizeOf = []( size_t v ) { return ( v * 7 ) % N + 1; };
+  size_t elements = 0;
+  for ( size_t v = 0; v < kLiveVectors; ++v )
+    elements += sizeOf( v );
+
+  inplace_vector_pool<int, N> pool( kLiveVectors );
+  std::vector<inplace_vector<int, N>*> pooled( kLiveVectors );
+  Report( "acquire/fill/release", "int"sv, "pool"sv, N, MeasureLoop( elements,
+    [&]()
+    {
+      for ( size_t v = 0; v < kLiveVectors; ++v )
+      {
+        pooled[ v ] = pool.acquire();
+        for ( size_t i = 0, size = sizeOf( v ); i < size; ++i )
+          pooled[ v ]->unchecked_push_back( static_cast<int>( i ) );
+      }
+      for ( auto* iv : pooled )
+      {
+        Consume( *iv );
+        pool.release( iv );
+      }
+    } ) );
+
+  std::vector<std::vector<int>> vectors( kLiveVectors );
+  Report( "acquire/fill/release", "int"sv, "std::vector"sv, N, MeasureLoop( elements,
+    [&]()
+    {
+      for ( size_t v = 0; v < kLiveVectors; ++v )
+        for ( size_t i = 0, size = sizeOf( v ); i < size; ++i )
+          vectors[ v ].push_back( static_cast<int>( i ) );
+      for ( auto& vec : vectors )
+      {
+        Consume( vec );
+        vec = std::vector<int>{}; // frees
+      }
+    } ) );
+
+  // Geometric growth in a monotonic resource never reuses freed blocks; size for the worst case
+  std::vector<std::byte> buffer( kLiveVectors * N * sizeof( int ) * 4 );
+  Report( "acquire/fill/release", "int"sv, "std::pmr::vector"sv, N, MeasureLoop( elements,
+    [&]()
+    {
+      std::pmr::monotonic_buffer_resource resource( buffer.data(), buffer.size() );
+      std::pmr::vector<std::pmr::vector<int>> pmrVectors( &resource );
+      pmrVectors.reserve( kLiveVectors );
+      for ( size_t v = 0; v < kLiveVectors; ++v )
+      {
+        auto& vec = pmrVectors.emplace_back();
+        for ( size_t i = 0, size = sizeOf( v ); i < size; ++i )
+          vec.push_back( static_cast<int>( i ) );
+      }
+      for ( const auto& vec : pmrVectors )
+        Consume( vec );
+    } ) );
+}
+
+// One producer thread hands kItems ints to one consumer thread in batches of up to B.
+// The mutex baseline is what inplace_spsc_ring replaces: a locked inplace_vector.
+template <size_t N, size_t B>
+void RunRingBenchmarks()
+{
+  constexpr int kItems = 1 << 22;
+  std::array<int, B> values{};
+  std::iota( values.begin(), values.end(), 0 );
+
+  // thread 0 produces, thread 1 consumes; a sample ends with the ring empty again
+  inplace_spsc_ring<int, N> ring;
+  Report( "spsc handoff", "int"sv, "inplace_spsc_ring"sv, N, MeasureThreads( kItems, 2, []() {},
+    [&]( size_t t )
+    {
+      if ( t == 0 )
+      {
+        for ( int sent = 0; sent < kItems; )
+        {
+          auto first = values.begin();
+          auto last = values.begin() + static_cast<ptrdiff_t>( std::min( B, size_t( kItems - sent ) ) );
+          auto next = ring.try_push_range( std::ranges::subrange( first, last ) );
+          sent += static_cast<int>( next - first );
+        }
+        return;
+      }
+      inplace_vector<int, B> batch;
+      for ( int received = 0; received < kItems; )
+      {
+        batch.clear();
+        received += static_cast<int>( ring.try_pop_into( batch ) );
+      }
+      Consume( batch );
+    } ) );
+
+  std::mutex mutex;
+  inplace_vector<int, N> shared;
+  Report( "spsc handoff", "int"sv, "mutex+inplace_vec"sv, N, MeasureThreads( kItems, 2, []() {},
+    [&]( size_t t )
+    {
+      if ( t == 0 )
+      {
+        for ( int sent = 0; sent < kItems; )
+        {
+          auto first = values.begin();
+          auto last = values.begin() + static_cast<ptrdiff_t>( std::min( B, size_t( kItems - sent ) ) );
+          std::scoped_lock lock( mutex );
+          auto next = shared.try_append_range( std::ranges::subrange( first, last ) );
+          sent += static_cast<int>( next - first );
+        }
+        return;
+      }
+      inplace_vector<int, N> batch;
+      for ( int received = 0; received < kItems; )
+      {
+        {
+          std::scoped_lock lock( mutex );
+          batch = shared;
+          shared.clear();
+        }
+        received += static_cast<int>( batch.size() );
+      }
+      Consume( batch );
+    } ) );
+}
+
+void ReportThroughput( std::string_view op, std::string_view container, size_t threads,
+                       const Result& result )
+{
+  std::cout << std::format( "{:<22}{:<5}{:<18}{:>6}{:>16.0f} items/s\n",
+                            op, "int"sv, container, threads, 1e9 / result.nsPerOp );
+}
+
+// `threads` producers and `threads` consumers move batches of B ints through a queue
+// bounded to Slots batches. The baseline is a mutex-guarded std::deque with the same bound.
+template <size_t B, size_t Slots>
+void RunQueueBenchmarks()
+{
+  using Batch = inplace_vector<int, B>;
+  constexpr size_t kBatchesPerProducer = 1 << 12;
+
+  Batch full( B );
+  std::iota( full.begin(), full.end(), 0 );
+
+  constexpr std::array<size_t, 5> kThreadCounts = { 1, 2, 4, 8, 16 };
+  for ( size_t threads : kThreadCounts )
+  {
+    const size_t items = threads * kBatchesPerProducer * B;
+    // even threads produce, odd threads consume
+    auto runWorkers = [&]( auto&& produce, auto&& consume )
+      {
+        std::atomic<size_t> received = 0;
+        return MeasureThreads( items, 2 * threads, [&]() { received = 0; },
+          [&]( size_t t )
+          {
+            if ( t % 2 == 0 )
+            {
+              for ( size_t b = 0; b < kBatchesPerProducer; ++b )
+                while ( !produce( full ) )
+                  std::this_thread::yield();
+              return;
+            }
+            Batch batch;
+            while ( received.load( std::memory_order_relaxed ) < items )
+            {
+              if ( consume( batch ) )
+                received.fetch_add( batch.size(), std::memory_order_relaxed );
+              else
+                std::this_thread::yield();
+            }
+          } );
+      };
+
+    auto queue = std::make_unique<inplace_mpmc_queue<Batch, Slots>>(); // too big for the stack
+    ReportThroughput( "mpmc batches", "inplace_mpmc_queue"sv, threads,
+      runWorkers( [&]( const Batch& batch ) { return queue->try_push( batch ); },
+                  [&]( Batch& batch ) { return queue->try_pop( batch ); } ) );
+
+    std::mutex mutex;
+    std::deque<Batch> deque;
+    ReportThroughput( "mpmc batches", "mutex+std::deque"sv, threads,
+      runWorkers( [&]( const Batch& batch )
+                  {
+                    std::scoped_lock lock( mutex );
+                    if ( deque.size() == Slots )
+                      return false;
+                    deque.push_back( batch );
+                    return true;
+                  },
+                  [&]( Batch& batch )
+                  {
+                    std::scoped_lock lock( mutex );
+                    if ( deque.empty() )
+                      return false;
+                    batch = std::move( deque.front() );
+                    deque.pop_front();
+                    return true;
+                  } ) );
+  }
+}
+
+struct Particle
+{
+  float x, y, z;
+  float vx, vy, vz;
+  float mass;
+  int id;
+};
+
+// Scans two of Particle's eight fields. AoS drags all 32 bytes of each particle through
+// the cache; SoA touches only the two columns it reads.
+template <size_t N>
+void RunSoaBenchmarks()
+{
+  auto aos = std::make_unique<inplace_vector<Particle, N>>();
+  auto soa = std::make_unique<inplace_soa_vector<N, float, float, float, float, float, float, float, int>>();
+  for ( size_t i = 0; i < N; ++i )
+  {
+    const auto f = static_cast<float>( i );
+    aos->push_back( Particle{ f, f, f, 1.0f, 1.0f, 1.0f, 2.0f, static_cast<int>( i ) } );
+    soa->push_back( f, f, f, 1.0f, 1.0f, 1.0f, 2.0f, static_cast<int>( i ) );
+  }
+
+  Report( "scan x += vx", "flt"sv, "inplace_vector"sv, N, MeasureLoop( N,
+    [&]()
+    {
+      for ( auto& p : *aos )
+        p.x += p.vx;
+      Consume( *aos );
+    } ) );
+
+  Report( "scan x += vx", "flt"sv, "inplace_soa_vector"sv, N, MeasureLoop( N,
+    [&]()
+    {
+      auto xs = soa->template column<0>();
+      auto vxs = soa->template column<3>();
+      for ( size_t i = 0; i < xs.size(); ++i )
+        xs[ i ] += vxs[ i ];
+      Consume( xs );
+    } ) );
+
+  Report( "zip scan x += vx", "flt"sv, "inplace_soa_vector"sv, N, MeasureLoop( N,
+    [&]()
+    {
+      for ( auto&& p : *soa )
+        std::get<0>( p ) += std::get<3>( p );
+      Consume( soa->template column<0>() );
+    } ) );
+}
+
+// Looks up every key of an N-element int map in shuffled order. The build row times
+// constructing the map from unsorted pairs: one sort-and-merge for insert_range versus
+// N node insertions for std::map.
+template <size_t N>
+void RunFlatMapBenchmarks()
+{
+  std::vector<std::pair<int, int>> pairs;
+  for ( size_t i = 0; i < N; ++i )
+    pairs.emplace_back( static_cast<int>( i * 2654435761u % 1000003u ), static_cast<int>( i ) );
+  std::vector<int> probes;
+  for ( const auto& [key, value] : pairs )
+    probes.push_back( key );
+  std::shuffle( probes.begin(), probes.end(), std::mt19937{ 42 } );
+
+  auto lookups = [&]( const auto& map )
+    {
+      return MeasureLoop( probes.size(), [&]()
+        {
+          size_t found = 0;
+          for ( int key : probes )
+            found += map.contains( key ) ? 1u : 0u;
+          gSink = found;
+        } );
+    };
+
+  inplace_flat_map<int, int, N> flat;
+  Report( "flat map build", "int"sv, "inplace_flat_map"sv, N, MeasureLoop( N, [&]()
+    {
+      flat.clear();
+      flat.insert_range( pairs );
+      gSink = flat.size();
+    } ) );
+  Report( "flat map lookup", "int"sv, "inplace_flat_map"sv, N, lookups( flat ) );
+
+#if defined( __cpp_lib_flat_map )
+  std::flat_map<int, int> stdFlat( pairs.begin(), pairs.end() );
+  Report( "flat map lookup", "int"sv, "std::flat_map"sv, N, lookups( stdFlat ) );
+#endif
+
+  std::map<int, int> map;
+  Report( "flat map build", "int"sv, "std::map"sv, N, MeasureLoop( N, [&]()
+    {
+      map.clear();
+      map.insert( pairs.begin(), pairs.end() );
+      gSink = map.size();
+    } ) );
+  Report( "flat map lookup", "int"sv, "std::map"sv, N, lookups( map ) );
+}
+
+// Hashes element by element, the way a hand-written hasher for a container key would
+struct CombineHash
+{
+  template <typename Container>
+  size_t operator()( const Container& c ) const
+  {
+    size_t seed = c.size();
+    for ( const auto& e : c )
+      seed ^= std::hash<typename Container::value_type>{}( e ) + size_t{ 0x9E3779B9 } +
+              ( seed << 6 ) + ( seed >> 2 );
+    return seed;
+  }
+};
+
+// Keys are N random bytes; N is the key length. std::hash<inplace_vector> hashes
+// trivially copyable contents in one pass and <=> on unsigned bytes is a memcmp, so the
+// inplace_vector rows should track std::string rather than the element-wise combine row.
+template <size_t N>
+void RunHashBenchmarks()
+{
+  using Key = inplace_vector<uint8_t, N>;
+  constexpr size_t kKeys = 4096;
+
+  std::mt19937 rng{ 42 };
+  std::vector<Key> keys;
+  std::vector<std::string> strings;
+  for ( size_t i = 0; i < kKeys; ++i )
+  {
+    Key key;
+    for ( size_t j = 0; j < N; ++j )
+      key.push_back( static_cast<uint8_t>( rng() ) );
+    strings.emplace_back( key.begin(), key.end() );
+    keys.push_back( key );
+  }
+
+  auto build = [&]( auto& map, const auto& src )
+    {
+      return MeasureLoop( src.size(), [&]()
+        {
+          map.clear();
+          for ( const auto& key : src )
+            map.emplace( key, 0 );
+          gSink = map.size();
+        } );
+    };
+
+  auto lookups = [&]( const auto& map, const auto& src )
+    {
+      return MeasureLoop( src.size(), [&]()
+        {
+          size_t found = 0;
+          for ( const auto& key : src )
+            found += map.contains( key ) ? 1u : 0u;
+          gSink = found;
+        } );
+    };
+
+  auto sort = [&]( const auto& src )
+    {
+      using Container = std::remove_cvref_t<decltype( src )>;
+      return Measure<Container>( src.size(), src.size(),
+        [&]( Container&, Container& b )
+        {
+          b = src;
+        },
+        []( Container&, Container& b )
+        {
+          std::ranges::sort( b );
+        } );
+    };
+
+  std::unordered_map<Key, int> ivMap;
+  Report( "hash build", "u8"sv, "inplace_vector"sv, N, build( ivMap, keys ) );
+  Report( "hash lookup", "u8"sv, "inplace_vector"sv, N, lookups( ivMap, keys ) );
+
+  std::unordered_map<Key, int, CombineHash> combineMap;
+  Report( "hash build combine", "u8"sv, "inplace_vector"sv, N, build( combineMap, keys ) );
+  Report( "hash lookup combine", "u8"sv, "inplace_vector"sv, N, lookups( combineMap, keys ) );
+
+  std::unordered_map<std::string, int> stringMap;
+  Report( "hash build", "u8"sv, "std::string"sv, N, build( stringMap, strings ) );
+  Report( "hash lookup", "u8"sv, "std::string"sv, N, lookups( stringMap, strings ) );
+
+  Report( "sort", "u8"sv, "inplace_vector"sv, N, sort( keys ) );
+  Report( "sort", "u8"sv, "std::string"sv, N, sort( strings ) );
+}
+
+template <typename Container, size_t N>
+void RunShiftRows( std::string_view name )
+{
+  constexpr auto half = N / 2;
+  auto setup = []( Container&, Container& b )
+    {
+      b.clear();
+      for ( size_t i = 0; i < half; ++i )
+        b.push_back( static_cast<int>( i ) );
+    };
+
+  Report( "insert middle", "int"sv, name, N, Measure<Container>( N, half, setup,
+    []( Container&, Container& b )
+    {
+      for ( size_t i = 0; i < half; ++i )
+        b.insert( b.begin() + static_cast<ptrdiff_t>( b.size() / 2 ), 0 );
+    } ) );
+
+  Report( "erase middle", "int"sv, name, N, Measure<Container>( N, half, setup,
+    []( Container&, Container& b )
+    {
+      while ( !b.empty() )
+        b.erase( b.begin() + static_cast<ptrdiff_t>( b.size() / 2 ) );
+    } ) );
+}
+
+// Cost of the tracing policy on shifting operations; the histogram sink adds two clock
+// reads and a bucket increment per call
+template <size_t N>
+void RunTraceBenchmarks()
+{
+  RunShiftRows<inplace_vector<int, N>, N>( "inplace_vector"sv );
+  RunShiftRows<inplace_vector<int, N, inplace_vector_trace<inplace_trace_histogram>>, N>( "traced histogram"sv );
+  inplace_trace_histogram::instance().reset();
+}
+
+// Erase-heavy trace: erase half of N elements in random order. inplace_vector shifts
+// the tail on every erase; inplace_slot_vector tombstones the slot. The churn rows
+// interleave erases and inserts, and the scan rows sum the survivors, paying for the
+// holes the slot vector leaves behind.
+template <typename T, size_t N>
+void RunSlotVectorBenchmarks()
+{
+  constexpr auto type = TypeName<T>();
+  constexpr auto half = N / 2;
+  using Vector = inplace_vector<T, N>;
+  using Slots = inplace_slot_vector<T, N>;
+
+  std::mt19937 rng{ 42 };
+  std::vector<size_t> slots( N );
+  std::iota( slots.begin(), slots.end(), size_t{ 0 } );
+  std::shuffle( slots.begin(), slots.end(), rng );
+  slots.resize( half );
+  std::vector<size_t> positions;
+  for ( size_t i = 0; i < half; ++i )
+    positions.push_back( rng() % ( N - i ) );
+  const T value = MakeValue<T>( N );
+
+  auto fill = [&]( auto& c )
+    {
+      c.clear();
+      for ( size_t i = 0; i < N; ++i )
+        c.insert( c.end(), MakeValue<T>( i ) );
+    };
+  auto fillSlots = [&]( Slots& s )
+    {
+      s.clear();
+      for ( size_t i = 0; i < N; ++i )
+        s.insert( MakeValue<T>( i ) );
+    };
+  auto nth = []( Vector& v, size_t i ) { return v.begin() + static_cast<ptrdiff_t>( i ); };
+
+  Report( "erase random half", type, "inplace_vector"sv, N, Measure<Vector>( N, half,
+    [&]( Vector&, Vector& b ) { fill( b ); },
+    [&]( Vector&, Vector& b )
+    {
+      for ( auto pos : positions )
+        b.erase( nth( b, pos ) );
+    } ) );
+
+  Report( "erase random half", type, "slot_vector"sv, N, Measure<Slots>( N, half,
+    [&]( Slots&, Slots& b ) { fillSlots( b ); },
+    [&]( Slots&, Slots& b )
+    {
+      for ( auto slot : slots )
+        b.erase( slot );
+    } ) );
+
+  Report( "erase/insert churn", type, "inplace_vector"sv, N, Measure<Vector>( N, half,
+    [&]( Vector&, Vector& b ) { fill( b ); },
+    [&]( Vector&, Vector& b )
+    {
+      for ( auto pos : positions )
+      {
+        b.erase( nth( b, pos ) );
+        b.push_back( value );
+      }
+    } ) );
+
+  Report( "erase/insert churn", type, "slot_vector"sv, N, Measure<Slots>( N, half,
+    [&]( Slots&, Slots& b ) { fillSlots( b ); },
+    [&]( Slots&, Slots& b )
+    {
+      for ( auto slot : slots )
+      {
+        b.erase( slot );
+        b.insert( value );
+      }
+    } ) );
+
+  auto scan = [&]( auto& c )
+    {
+      size_t visited = 0;
+      for ( const auto& e : c )
+      {
+        static_cast<void>( e );
+        ++visited;
+      }
+      gSink = visited;
+    };
+
+  auto erased = std::make_unique<Vector>();
+  fill( *erased );
+  for ( auto pos : positions )
+    erased->erase( nth( *erased, pos ) );
+  Report( "scan after erase", type, "inplace_vector"sv, N, MeasureLoop( half,
+    [&]() { scan( *erased ); } ) );
+
+  auto tombstoned = std::make_unique<Slots>();
+  fillSlots( *tombstoned );
+  for ( auto slot : slots )
+    tombstoned->erase( slot );
+  Report( "scan after erase", type, "slot_vector"sv, N, MeasureLoop( half,
+    [&]() { scan( *tombstoned ); } ) );
+  tombstoned->compact();
+  Report( "scan after compact", type, "slot_vector"sv, N, MeasureLoop( half,
+    [&]() { scan( *tombstoned ); } ) );
+}
+
+} // anonymous namespace
+
+#define STRINGIZE2( x ) #x
+#define STRINGIZE( x ) STRINGIZE2( x )
+
+int __cdecl main()
+{
+#if defined( PKISENSEE_CONTRACT_MODE )
+  std::cout << "contract mode: " STRINGIZE( PKISENSEE_CONTRACT_MODE ) "\n";
+#else
+  std::cout << "contract mode: default\n";
+#endif
+  std::cout << std::format( "{:<22}{:<5}{:<18}{:>6}{:>12}{:>12}\n",
+                            "operation", "T", "container", "N", "ns/op", "cycles/op" );
+  RunAllCapacities<int>( Capacities{} );
+  RunAllCapacities<double>( Capacities{} ); // trivially copyable; copy/move/swap are bulk copies
+  RunAllCapacities<M>( Capacities{} );
+  RunAllCapacities<MR>( Capacities{} ); // relocatable M; insert/erase/swap shift with memmove
+
+  RunInsertRangeBenchmarks<inplace_vector<int, 1024>, 1024>();
+  RunInsertRangeBenchmarks<std::vector<int>, 1024>();
+  RunInsertRangeBenchmarks<inplace_vector<M, 1024>, 1024>();
+  RunInsertRangeBenchmarks<std::vector<M>, 1024>();
+
+  RunPoolBenchmarks<16>();
+  RunPoolBenchmarks<256>();
+  RunPoolBenchmarks<4096>();
+
+  RunRingBenchmarks<256, 32>();
+  RunRingBenchmarks<4096, 256>();
+
+  RunQueueBenchmarks<64, 1024>();
+
+  RunSoaBenchmarks<1024>();
+  RunSoaBenchmarks<65536>();
+
+  RunFlatMapBenchmarks<8>();
+  RunFlatMapBenchmarks<32>();
+  RunFlatMapBenchmarks<128>();
+  RunFlatMapBenchmarks<512>();
+
+  RunHashBenchmarks<8>();
+  RunHashBenchmarks<32>();
+  RunHashBenchmarks<128>();
+
+  RunTraceBenchmarks<64>();
+  RunTraceBenchmarks<1024>();
+
+  RunSlotVectorBenchmarks<int, 1024>();
+  RunSlotVectorBenchmarks<M, 1024>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
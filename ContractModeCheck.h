@@ -0,0 +1,40 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  ContractModeCheck.h
+//
+//  Copyright  Pete Isensee (PKIsensee@msn.com).
+//  All rights reserved worldwide.
+//
+//  Permission to copy, modify, reproduce or redistribute this source code is
+//  granted provided the above copyright notice is retained in the resulting 
+//  source code.
+// 
+//  This software is provided "as is" and without any express or implied
+//  warranties.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Compile check shared by the ContractMode*.cpp files. Each defines
+// PKISENSEE_CONTRACT_MODE and includes this header; every checked operation then has to
+// compile, and be usable in a constant expression, in that mode. The files build into
+// the ContractModes static library, which nothing links: inplace_vector is defined
+// differently in each, so they must never become part of the same program.
+
+#pragma once
+
+#include "inplace_vector.h"
+
+static_assert( []
+  {
+    PKIsensee::inplace_vector<int, 4> iv{ 1, 2, 3 };
+    const auto& civ = iv;
+    auto sum = iv[ 0 ] + iv.front() + iv.back();
+    sum += civ[ 1 ] + civ.front() + civ.back();
+    iv.unchecked_push_back( 4 );
+    iv.pop_back();
+    iv.unchecked_emplace_back( 5 );
+    iv.erase( iv.begin() );
+    return sum == 11 && iv.size() == 3 && iv.back() == 5;
+  }() );
+
+///////////////////////////////////////////////////////////////////////////////
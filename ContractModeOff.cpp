@@ -0,0 +1,20 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  ContractModeOff.cpp
+//
+//  Copyright  Pete Isensee (PKIsensee@msn.com).
+//  All rights reserved worldwide.
+//
+//  Permission to copy, modify, reproduce or redistribute this source code is
+//  granted provided the above copyright notice is retained in the resulting 
+//  source code.
+// 
+//  This software is provided "as is" and without any express or implied
+//  warranties.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#define PKISENSEE_CONTRACT_MODE off
+#include "ContractModeCheck.h"
+
+///////////////////////////////////////////////////////////////////////////////
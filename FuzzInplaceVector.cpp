@@ -0,0 +1,377 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  FuzzInplaceVector.cpp
+//
+//  Copyright  Pete Isensee (PKIsensee@msn.com).
+//  All rights reserved worldwide.
+//
+//  Permission to copy, modify, reproduce or redistribute this source code is
+//  granted provided the above copyright notice is retained in the resulting 
+//  source code.
+// 
+//  This software is provided "as is" and without any express or implied
+//  warranties.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "inplace_vector.h"
+
+using namespace PKIsensee;
+
+// libFuzzer/AFL++ target. Each input is decoded into a sequence of mutating operations
+// that run in lockstep on inplace_vector<T, kCapacity> and std::vector<T>, the reference
+// model. After every operation the contents must match, and an operation must throw
+// bad_alloc exactly when the reference would grow past kCapacity.
+//
+// Build with the FuzzInplaceVector project (/fsanitize=fuzzer,address) and run e.g.
+//   FuzzInplaceVector.exe -max_len=512 corpus
+
+namespace { // anonymous
+
+constexpr size_t kCapacity = 16;
+
+// Non-trival object; like M in TestInplaceVector.cpp, the destructor overwrites the
+// state so a comparison that reads a destroyed element mismatches the reference
+class M
+{
+public:
+  M() : M( "Initialized", 42, 123.456f )
+  {
+  }
+
+  M( const std::string& s, int i, float f ) :
+    s_{ s },
+    v_{ i, i },
+    p_{ new float{ f } }
+  {
+  }
+
+  M( const M& ) = default;
+  M( M&& ) = default;
+  M& operator=( const M& ) = default;
+  M& operator=( M&& ) = default;
+
+  ~M()
+  {
+    s_ = "Destroyed";
+    v_.assign( 3, 0xDEADBEEF );
+    p_.reset( new float{ 654.321f } );
+  }
+
+  bool operator==( const M& rhs ) const
+  {
+    return s_ == rhs.s_ &&
+           v_ == rhs.v_ &&
+          *p_ == *rhs.p_;
+  }
+
+  int key() const
+  {
+    return v_.empty() ? 0 : v_.front();
+  }
+
+private:
+  std::string s_;
+  std::vector<int> v_;
+  std::shared_ptr<float> p_;
+};
+
+// Opted in to bitwise relocation; exercises the memmove paths. Not derived from M: with
+// _ITERATOR_DEBUG_LEVEL > 0 (Debug and the ASAN build) std::string and std::vector own
+// a proxy that points back at the container, which a memmove would leave dangling.
+class MR
+{
+public:
+  MR() : MR( "Initialized", 42, 123.456f )
+  {
+  }
+
+  MR( const std::string& s, int i, float f ) :
+    s_{ std::make_unique<std::string>( s ) },
+    i_{ i },
+    f_{ f }
+  {
+  }
+
+  MR( const MR& rhs ) : MR( *rhs.s_, rhs.i_, rhs.f_ )
+  {
+  }
+
+  MR& operator=( const MR& rhs )
+  {
+    s_ = std::make_unique<std::string>( *rhs.s_ );
+    i_ = rhs.i_;
+    f_ = rhs.f_;
+    return *this;
+  }
+
+  MR( MR&& ) = default;
+  MR& operator=( MR&& ) = default;
+  ~MR() = default;
+
+  bool operator==( const MR& rhs ) const
+  {
+    return *s_ == *rhs.s_ &&
+           i_ == rhs.i_ &&
+           f_ == rhs.f_;
+  }
+
+  int key() const
+  {
+    return i_;
+  }
+
+private:
+  std::unique_ptr<std::string> s_; // the string and its proxy stay put on the heap
+  int i_;
+  float f_;
+};
+
+} // anonymous namespace
+
+namespace PKIsensee
+{
+template <>
+struct is_trivially_relocatable<MR> : std::true_type {};
+}
+
+namespace { // anonymous
+
+void Check( bool condition )
+{
+  if ( !condition )
+    std::abort(); // reported by the fuzzer as a crash with the offending input
+}
+
+class Reader
+{
+public:
+  Reader( const uint8_t* data, size_t size ) : data_{ data }, size_{ size }
+  {
+  }
+
+  bool empty() const
+  {
+    return pos_ == size_;
+  }
+
+  uint8_t next()
+  {
+    return empty() ? uint8_t{ 0 } : data_[ pos_++ ];
+  }
+
+  // Position in [0, limit]
+  size_t index( size_t limit )
+  {
+    return next() % ( limit + 1 );
+  }
+
+private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t pos_ = 0;
+};
+
+template <typename T>
+T MakeValue( uint8_t v )
+{
+  return T{ std::string( 1, static_cast<char>( 'a' + v % 26 ) ), v, static_cast<float>( v ) };
+}
+
+template <typename T>
+class Lockstep
+{
+public:
+  using IV = inplace_vector<T, kCapacity>;
+  using Ref = std::vector<T>;
+
+  void run( Reader& in )
+  {
+    while ( !in.empty() )
+    {
+      step( in );
+      Check( std::ranges::equal( iv_, ref_ ) );
+      Check( std::ranges::equal( ivOther_, refOther_ ) );
+      Check( iv_.capacity() == kCapacity );
+    }
+  }
+
+private:
+  // Runs op on both containers; op must throw bad_alloc iff newSize would exceed capacity
+  template <typename IvOp, typename RefOp>
+  void grow( size_t newSize, IvOp&& ivOp, RefOp&& refOp )
+  {
+    const bool overflows = newSize > kCapacity;
+    bool threw = false;
+    try
+    {
+      ivOp();
+    }
+    catch ( const std::bad_alloc& )
+    {
+      threw = true;
+    }
+    Check( threw == overflows );
+    if ( !overflows )
+      refOp();
+  }
+
+  void step( Reader& in )
+  {
+    const auto size = ref_.size();
+    const auto op = in.next() % 15;
+    switch ( op )
+    {
+    case 0: // push_back
+    {
+      auto v = MakeValue<T>( in.next() );
+      grow( size + 1, [&]() { iv_.push_back( v ); }, [&]() { ref_.push_back( v ); } );
+      break;
+    }
+    case 1: // insert( pos, value )
+    {
+      auto pos = static_cast<ptrdiff_t>( in.index( size ) );
+      auto v = MakeValue<T>( in.next() );
+      grow( size + 1, [&]() { iv_.insert( iv_.begin() + pos, v ); },
+                      [&]() { ref_.insert( ref_.begin() + pos, v ); } );
+      break;
+    }
+    case 2: // insert( pos, count, value )
+    {
+      auto pos = static_cast<ptrdiff_t>( in.index( size ) );
+      auto count = in.index( kCapacity );
+      auto v = MakeValue<T>( in.next() );
+      grow( size + count, [&]() { iv_.insert( iv_.begin() + pos, count, v ); },
+                          [&]() { ref_.insert( ref_.begin() + pos, count, v ); } );
+      break;
+    }
+    case 3: // erase( pos )
+      if ( size > 0 )
+      {
+        auto pos = static_cast<ptrdiff_t>( in.index( size - 1 ) );
+        auto ivIt = iv_.erase( iv_.begin() + pos );
+        ref_.erase( ref_.begin() + pos );
+        Check( ivIt == iv_.begin() + pos );
+      }
+      break;
+    case 4: // erase( first, last )
+    {
+      auto first = in.index( size );
+      auto last = first + in.index( size - first );
+      auto ivIt = iv_.erase( iv_.begin() + static_cast<ptrdiff_t>( first ),
+                             iv_.begin() + static_cast<ptrdiff_t>( last ) );
+      ref_.erase( ref_.begin() + static_cast<ptrdiff_t>( first ),
+                  ref_.begin() + static_cast<ptrdiff_t>( last ) );
+      Check( ivIt == iv_.begin() + static_cast<ptrdiff_t>( first ) );
+      break;
+    }
+    case 5: // resize( n )
+    {
+      auto n = in.index( kCapacity + 1 );
+      grow( n, [&]() { iv_.resize( n ); }, [&]() { ref_.resize( n ); } );
+      break;
+    }
+    case 6: // resize( n, value )
+    {
+      auto n = in.index( kCapacity + 1 );
+      auto v = MakeValue<T>( in.next() );
+      grow( n, [&]() { iv_.resize( n, v ); }, [&]() { ref_.resize( n, v ); } );
+      break;
+    }
+    case 7: // swap
+      iv_.swap( ivOther_ );
+      ref_.swap( refOther_ );
+      break;
+    case 8: // try_append_range; appends what fits, never throws
+    {
+      auto values = MakeRange( in );
+      auto fits = std::min( values.size(), kCapacity - size );
+      auto it = iv_.try_append_range( values );
+      Check( it == values.begin() + static_cast<ptrdiff_t>( fits ) );
+      ref_.insert( ref_.end(), values.begin(), values.begin() + static_cast<ptrdiff_t>( fits ) );
+      break;
+    }
+    case 9: // append_range
+    {
+      auto values = MakeRange( in );
+      grow( size + values.size(), [&]() { iv_.append_range( values ); },
+                                  [&]() { ref_.insert( ref_.end(), values.begin(), values.end() ); } );
+      break;
+    }
+    case 10: // insert_range
+    {
+      auto pos = static_cast<ptrdiff_t>( in.index( size ) );
+      auto values = MakeRange( in );
+      grow( size + values.size(), [&]() { iv_.insert_range( iv_.begin() + pos, values ); },
+                                  [&]() { ref_.insert( ref_.begin() + pos, values.begin(), values.end() ); } );
+      break;
+    }
+    case 11: // erase_if
+    {
+      const int divisor = in.next() % 4 + 1;
+      auto pred = [divisor]( const T& t ) { return t.key() % divisor == 0; };
+      Check( erase_if( iv_, pred ) == std::erase_if( ref_, pred ) );
+      break;
+    }
+    case 12: // pop_back
+      if ( size > 0 )
+      {
+        iv_.pop_back();
+        ref_.pop_back();
+      }
+      break;
+    case 13: // assign( n, value )
+    {
+      auto n = in.index( kCapacity + 1 );
+      auto v = MakeValue<T>( in.next() );
+      grow( n, [&]() { iv_.assign( n, v ); }, [&]() { ref_.assign( n, v ); } );
+      break;
+    }
+    default: // copy and move assignment round trip through the other pair
+      ivOther_ = iv_;
+      refOther_ = ref_;
+      iv_ = std::move( ivOther_ );
+      ref_ = std::move( refOther_ );
+      ivOther_ = iv_;
+      refOther_ = ref_;
+      break;
+    }
+  }
+
+  static std::vector<T> MakeRange( Reader& in )
+  {
+    std::vector<T> values( in.index( kCapacity / 2 ) );
+    for ( auto& v : values )
+      v = MakeValue<T>( in.next() );
+    return values;
+  }
+
+  IV iv_;
+  IV ivOther_;
+  Ref ref_;
+  Ref refOther_;
+};
+
+} // anonymous namespace
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t* data, size_t size )
+{
+  // Same operations on the element-wise and the relocation paths
+  Reader readerM( data, size );
+  Lockstep<M>{}.run( readerM );
+  Reader readerMR( data, size );
+  Lockstep<MR>{}.run( readerMR );
+  return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
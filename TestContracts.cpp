@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  TestContracts.cpp
+//
+//  Copyright  Pete Isensee (PKIsensee@msn.com).
+//  All rights reserved worldwide.
+//
+//  Permission to copy, modify, reproduce or redistribute this source code is
+//  granted provided the above copyright notice is retained in the resulting 
+//  source code.
+// 
+//  This software is provided "as is" and without any express or implied
+//  warranties.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Contract violations throw rather than assert so the precondition checks can be tested.
+// Kept out of TestInplaceVector.cpp, which runs in the default mode. The off, trap and
+// log modes are compile-checked by ContractMode*.cpp.
+#define PKISENSEE_CONTRACT_MODE throw_exception
+
+#include <cassert>
+#include <stdexcept>
+#include <string_view>
+
+#include "inplace_vector.h"
+#include "Util.h"
+
+using namespace PKIsensee;
+using namespace std::literals;
+
+#ifdef _DEBUG
+#define test(e) assert(e)
+#else
+#define test(e) static_cast<void>( (e) || ( Util::DebugBreak(), 0 ) )
+#endif
+
+#define testex(e, E, msg) TryCatch<E>( ( [&]() { (e); } ), msg );
+
+template <typename Exception, typename TryLambda>
+void TryCatch( TryLambda&& tryLambda, std::string_view exceptionMsg )
+{
+  try
+  {
+    tryLambda();
+    test( false ); // a violated contract must throw in this mode
+  }
+  catch ( Exception& ex )
+  {
+    test( ex.what() == exceptionMsg );
+  }
+  catch ( ... )
+  {
+    test( false );
+  }
+}
+
+int __cdecl main()
+{
+  // operator[]
+  {
+    inplace_vector<int, 5> iv( 3, 42 );
+    const auto& civ = iv;
+    test( iv[ 2 ] == 42 );
+    testex( iv[ 3 ], std::out_of_range&, "inplace_vector::operator[]"sv );
+    testex( civ[ 3 ], std::out_of_range&, "inplace_vector::operator[]"sv );
+  }
+
+  // front(), back()
+  {
+    inplace_vector<int, 5> iv;
+    const auto& civ = iv;
+    testex( iv.front(), std::out_of_range&, "inplace_vector::front"sv );
+    testex( civ.back(), std::out_of_range&, "inplace_vector::back"sv );
+    iv.push_back( 1 );
+    test( iv.front() == civ.back() );
+  }
+
+  // unchecked_emplace_back(), unchecked_push_back()
+  {
+    inplace_vector<char, 3> iv{ 'a', 'b', 'c' };
+    testex( iv.unchecked_emplace_back( 'd' ), std::out_of_range&, "inplace_vector::unchecked_emplace_back"sv );
+    testex( iv.unchecked_push_back( 'e' ), std::out_of_range&, "inplace_vector::unchecked_push_back"sv );
+    test( iv.size() == 3 );
+    test( iv.back() == 'c' );
+  }
+
+  // pop_back()
+  {
+    inplace_vector<char, 3> iv;
+    testex( iv.pop_back(), std::out_of_range&, "inplace_vector::pop_back"sv );
+    test( iv.empty() );
+  }
+
+  // erase()
+  {
+    inplace_vector<char, 5> iv{ 'a', 'b' };
+    testex( iv.erase( iv.end() ), std::out_of_range&, "inplace_vector::erase"sv ); // end() cannot be used for pos
+    test( iv.size() == 2 );
+    iv.clear();
+    testex( iv.erase( iv.begin() ), std::out_of_range&, "inplace_vector::erase"sv ); // cannot call on empty container
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
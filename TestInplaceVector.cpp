@@ -14,18 +14,107 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cmath>
+#include <compare>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <forward_list>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <list>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <ranges>
+#include <span>
+#include <stdexcept>
+#include <sstream>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
 #include "inplace_vector.h"
 #include "Util.h"
 
+#if __has_include( "inplace_async.h" )
+#include "inplace_async.h"
+#else
+#error "inplace_async.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_flat_map.h" )
+#include "inplace_flat_map.h"
+#else
+#error "inplace_flat_map.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_flat_set.h" )
+#include "inplace_flat_set.h"
+#else
+#error "inplace_flat_set.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_mpmc_queue.h" )
+#include "inplace_mpmc_queue.h"
+#else
+#error "inplace_mpmc_queue.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_slot_vector.h" )
+#include "inplace_slot_vector.h"
+#else
+#error "inplace_slot_vector.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_soa_vector.h" )
+#include "inplace_soa_vector.h"
+#else
+#error "inplace_soa_vector.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_spsc_ring.h" )
+#include "inplace_spsc_ring.h"
+#else
+#error "inplace_spsc_ring.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_vector_par.h" )
+#include "inplace_vector_par.h"
+#else
+#error "inplace_vector_par.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_vector_pool.h" )
+#include "inplace_vector_pool.h"
+#else
+#error "inplace_vector_pool.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "inplace_vector_view.h" )
+#include "inplace_vector_view.h"
+#else
+#error "inplace_vector_view.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "shared_inplace_vector.h" )
+#include "shared_inplace_vector.h"
+#include <process.h> // _getpid() names the test mapping
+#else
+#error "shared_inplace_vector.h not found; it belongs in the InplaceVector project"
+#endif
+#if __has_include( "small_vector.h" )
+#include "small_vector.h"
+#else
+#error "small_vector.h not found; it belongs in the InplaceVector project"
+#endif
+
 using namespace PKIsensee;
 using namespace std::literals;
 
@@ -109,6 +198,1002 @@ private:
   std::shared_ptr<float> p_;
 };
 
+// Opts in to bitwise relocation; exercises the memmove paths. Unlike M, no member stores
+// its own address: with _ITERATOR_DEBUG_LEVEL > 0 every std::string and std::vector owns
+// a proxy that points back at the container, which a memmove would leave dangling.
+class R
+{
+public:
+  R() : R( "Initialized", 42, 123.456f )
+  {
+  }
+
+  R( const std::string& s, int i, float f ) :
+    s_{ std::make_unique<std::string>( s ) },
+    i_{ i },
+    f_{ f }
+  {
+  }
+
+  R( const R& rhs ) : R( *rhs.s_, rhs.i_, rhs.f_ )
+  {
+  }
+
+  R& operator=( const R& rhs )
+  {
+    s_ = std::make_unique<std::string>( *rhs.s_ );
+    i_ = rhs.i_;
+    f_ = rhs.f_;
+    return *this;
+  }
+
+  R( R&& ) = default;
+  R& operator=( R&& ) = default;
+  ~R() = default;
+
+  std::string getStr() const
+  {
+    return *s_;
+  }
+
+  bool operator==( const R& rhs ) const
+  {
+    return *s_ == *rhs.s_ &&
+           i_ == rhs.i_ &&
+           f_ == rhs.f_;
+  }
+
+private:
+  std::unique_ptr<std::string> s_; // the string and its proxy stay put on the heap
+  int i_;
+  float f_;
+};
+
+namespace PKIsensee
+{
+template <>
+struct is_trivially_relocatable<R> : std::true_type {};
+}
+
+struct SpecialMemberCounts
+{
+  size_t ctor = 0;
+  size_t copyCtor = 0;
+  size_t moveCtor = 0;
+  size_t copyAssign = 0;
+  size_t moveAssign = 0;
+  size_t dtor = 0;
+
+  bool operator==( const SpecialMemberCounts& ) const = default;
+};
+
+// Counts special member calls so tests can pin the exact cost of each operation.
+// Not trivially copyable, so every operation takes the element-wise path.
+class Counted
+{
+public:
+  static inline SpecialMemberCounts counts;
+
+  static void reset()
+  {
+    counts = {};
+  }
+
+  // Tests the counts since the previous check and starts over. Taking them as an
+  // argument keeps designated initializers, and their commas, out of test().
+  static void expect( const SpecialMemberCounts& expected )
+  {
+    test( std::exchange( counts, SpecialMemberCounts{} ) == expected );
+  }
+
+  Counted()
+  {
+    ++counts.ctor;
+  }
+
+  explicit Counted( int i ) : i_{ i }
+  {
+    ++counts.ctor;
+  }
+
+  Counted( const Counted& rhs ) : i_{ rhs.i_ }
+  {
+    ++counts.copyCtor;
+  }
+
+  Counted( Counted&& rhs ) noexcept : i_{ rhs.i_ }
+  {
+    ++counts.moveCtor;
+  }
+
+  Counted& operator=( const Counted& rhs )
+  {
+    i_ = rhs.i_;
+    ++counts.copyAssign;
+    return *this;
+  }
+
+  Counted& operator=( Counted&& rhs ) noexcept
+  {
+    i_ = rhs.i_;
+    ++counts.moveAssign;
+    return *this;
+  }
+
+  ~Counted()
+  {
+    ++counts.dtor;
+  }
+
+  int get() const
+  {
+    return i_;
+  }
+
+  bool operator==( const Counted& ) const = default;
+
+private:
+  int i_ = 0;
+};
+
+// Copying throws once copiesUntilThrow reaches zero. Tracks live objects so tests can
+// catch leaks and double destruction after a throw.
+class ThrowOnCopy
+{
+public:
+  static inline int live = 0;
+  static inline int copiesUntilThrow = -1; // negative never throws
+
+  explicit ThrowOnCopy( int i ) : i_{ i }
+  {
+    ++live;
+  }
+
+  ThrowOnCopy( const ThrowOnCopy& rhs ) : i_{ rhs.i_ }
+  {
+    countdown();
+    ++live;
+  }
+
+  ThrowOnCopy( ThrowOnCopy&& rhs ) noexcept : i_{ rhs.i_ }
+  {
+    ++live;
+  }
+
+  ThrowOnCopy& operator=( const ThrowOnCopy& rhs )
+  {
+    countdown();
+    i_ = rhs.i_;
+    return *this;
+  }
+
+  ThrowOnCopy& operator=( ThrowOnCopy&& rhs ) noexcept
+  {
+    i_ = rhs.i_;
+    return *this;
+  }
+
+  ~ThrowOnCopy()
+  {
+    --live;
+  }
+
+  int get() const
+  {
+    return i_;
+  }
+
+private:
+  static void countdown()
+  {
+    if ( copiesUntilThrow == 0 )
+      throw std::runtime_error( "ThrowOnCopy" );
+    if ( copiesUntilThrow > 0 )
+      --copiesUntilThrow;
+  }
+
+  int i_;
+};
+
+// Trace sink for the tracing policy tests; keeps every event
+struct RecordingSink
+{
+  static inline std::vector<inplace_trace_event> events;
+
+  static void record( const inplace_trace_event& event )
+  {
+    events.push_back( event );
+  }
+};
+
+// In-memory async byte source for async_fill. Each read hands back at most chunk bytes.
+// When manual is set, reads suspend until the test resumes them, like a pending recv().
+struct ChunkSource
+{
+  std::string_view data;
+  size_t chunk = 4;
+  bool manual = false;
+  std::coroutine_handle<> pending;
+
+  struct ReadAwaiter
+  {
+    ChunkSource& source;
+    std::span<std::byte> spare;
+
+    bool await_ready() const noexcept { return !source.manual; }
+    void await_suspend( std::coroutine_handle<> h ) noexcept { source.pending = h; }
+    size_t await_resume()
+    {
+      auto n = std::min( { source.chunk, spare.size(), source.data.size() } );
+      memcpy( spare.data(), source.data.data(), n );
+      source.data.remove_prefix( n );
+      return n;
+    }
+  };
+
+  ReadAwaiter async_read( std::span<std::byte> spare ) { return { *this, spare }; }
+};
+
+// In-memory async byte sink for async_drain; accepts at most chunk bytes per write
+struct ChunkSink
+{
+  std::string received;
+  size_t chunk = 3;
+
+  struct WriteAwaiter
+  {
+    ChunkSink& sink;
+    std::span<const std::byte> bytes;
+
+    bool await_ready() const noexcept { return true; }
+    void await_suspend( std::coroutine_handle<> ) noexcept {}
+    size_t await_resume()
+    {
+      auto n = std::min( sink.chunk, bytes.size() );
+      sink.received.append( reinterpret_cast<const char*>( bytes.data() ), n );
+      return n;
+    }
+  };
+
+  WriteAwaiter async_write( std::span<const std::byte> bytes ) { return { *this, bytes }; }
+};
+
+// IOCP integration sample: an async byte source and sink over a file opened with
+// FILE_FLAG_OVERLAPPED and bound to an I/O completion port. Each read or write starts
+// overlapped I/O and suspends; RunOnPort() resumes the coroutine when the completion
+// packet arrives. File handles need no networking layer, and sockets plug in the same way.
+struct IocpFile
+{
+  HANDLE file = INVALID_HANDLE_VALUE;
+  uint64_t offset = 0;
+
+  struct Op : OVERLAPPED
+  {
+    std::coroutine_handle<> waiter;
+    DWORD bytes = 0;
+  };
+
+  template <typename Start>
+  struct IoAwaiter
+  {
+    IocpFile& file;
+    Start start;
+    Op op{};
+
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend( std::coroutine_handle<> h ) noexcept
+    {
+      op.waiter = h;
+      op.Offset = static_cast<DWORD>( file.offset );
+      op.OffsetHigh = static_cast<DWORD>( file.offset >> 32 );
+      if ( start( file.file, &op ) || GetLastError() == ERROR_IO_PENDING )
+        return true; // a completion packet is queued either way
+      return false; // failed to start, e.g. ERROR_HANDLE_EOF; resume with 0 bytes
+    }
+    size_t await_resume() noexcept
+    {
+      file.offset += op.bytes;
+      return op.bytes;
+    }
+  };
+
+  auto async_read( std::span<std::byte> spare )
+  {
+    auto start = [spare]( HANDLE h, OVERLAPPED* ov )
+      {
+        return ReadFile( h, spare.data(), static_cast<DWORD>( spare.size() ), nullptr, ov ) != FALSE;
+      };
+    return IoAwaiter<decltype( start )>{ *this, start };
+  }
+
+  auto async_write( std::span<const std::byte> bytes )
+  {
+    auto start = [bytes]( HANDLE h, OVERLAPPED* ov )
+      {
+        return WriteFile( h, bytes.data(), static_cast<DWORD>( bytes.size() ), nullptr, ov ) != FALSE;
+      };
+    return IoAwaiter<decltype( start )>{ *this, start };
+  }
+};
+
+// Completion loop for a started task; a failed packet (end of file) resumes with 0 bytes
+template <typename Task>
+void RunOnPort( HANDLE port, Task& task )
+{
+  while ( !task.done() )
+  {
+    DWORD bytes = 0;
+    ULONG_PTR key = 0;
+    OVERLAPPED* ov = nullptr;
+    const bool ok = GetQueuedCompletionStatus( port, &bytes, &key, &ov, INFINITE ) != FALSE;
+    test( ov != nullptr );
+    auto* op = static_cast<IocpFile::Op*>( ov );
+    op->bytes = ok ? bytes : 0;
+    op->waiter.resume();
+  }
+}
+
+// Element-wise equality that also holds for NaN; erase keeps order, so the surviving
+// elements of both containers must match bit for bit
+template <typename T, size_t N>
+bool SameBits( const inplace_vector<T, N>& iv, const std::vector<T>& ref )
+{
+  return iv.size() == ref.size() &&
+         ( iv.empty() || memcmp( iv.data(), ref.data(), iv.size() * sizeof( T ) ) == 0 );
+}
+
+// Randomized differential test of erase, erase_if and comparisons against std::vector,
+// the scalar reference. Small value ranges force duplicates and long common prefixes;
+// sizes cover partial vector widths so the SIMD tails are exercised. Floating-point
+// runs also draw -0.0, NaN and denormals.
+template <typename T, size_t N>
+void TestArithmeticKernels( std::mt19937& rng )
+{
+  std::uniform_int_distribution<int> valueDist( 0, 7 );
+  std::uniform_int_distribution<size_t> sizeDist( 0, N );
+  auto randomValue = [&]()
+  {
+    const auto v = valueDist( rng );
+    if constexpr ( std::is_floating_point_v<T> )
+    {
+      if ( v < 2 ) // one draw in four
+      {
+        using Limits = std::numeric_limits<T>;
+        constexpr std::array<T, 4> kSpecials{ -T( 0 ), Limits::quiet_NaN(),
+                                              Limits::denorm_min(), -Limits::denorm_min() };
+        return kSpecials[ static_cast<size_t>( valueDist( rng ) ) % kSpecials.size() ];
+      }
+    }
+    return static_cast<T>( v );
+  };
+
+  for ( int i = 0; i < 200; ++i )
+  {
+    inplace_vector<T, N> a;
+    std::vector<T> refA;
+    for ( size_t size = sizeDist( rng ); size > 0; --size )
+      refA.push_back( a.push_back( randomValue() ) );
+
+    inplace_vector<T, N> b;
+    std::vector<T> refB;
+    if ( i % 2 == 0 ) // same contents, with at most one element changed
+    {
+      b = a;
+      refB = refA;
+      if ( !b.empty() )
+      {
+        auto pos = sizeDist( rng ) % b.size();
+        b[ pos ] = refB[ pos ] = randomValue();
+      }
+    }
+    else
+    {
+      for ( size_t size = sizeDist( rng ); size > 0; --size )
+        refB.push_back( b.push_back( randomValue() ) );
+    }
+
+    test( ( a == b ) == ( refA == refB ) );
+    test( ( a != b ) == ( refA != refB ) );
+    test( ( a <=> b ) == ( refA <=> refB ) );
+    test( ( a < b ) == ( refA < refB ) );
+
+    const T value = randomValue();
+    test( erase( a, value ) == std::erase( refA, value ) );
+    test( SameBits( a, refA ) );
+
+    const T threshold = randomValue();
+    auto pred = [threshold]( T x ) { return x < threshold; };
+    test( erase_if( b, pred ) == std::erase_if( refB, pred ) );
+    test( SameBits( b, refB ) );
+  }
+}
+
+// IEEE semantics the floating-point kernels must keep. A bitwise compare, a memcmp or a
+// flush-to-zero mode gets each of these wrong:
+// - -0.0 == +0.0, so erase( v, 0.0 ) removes both zeros and { -0.0 } == { +0.0 }
+// - NaN is unequal to everything, itself included: erase( v, NaN ) removes nothing,
+//   a vector holding NaN is unequal to its own copy, and <=> is unordered there
+// - denormals are nonzero and ordered; erase( v, 0.0 ) keeps them
+// Each special value sits in the last elements; 7 and 33 are not multiples of any SSE2,
+// AVX2 or NEON width, so they land in the scalar tail.
+template <typename T, size_t N>
+void TestFloatKernelSemantics()
+{
+  constexpr T kZero = T( 0 );
+  constexpr T kNegZero = -kZero;
+  constexpr T kNaN = std::numeric_limits<T>::quiet_NaN();
+  constexpr T kDenorm = std::numeric_limits<T>::denorm_min();
+  constexpr T kOne = T( 1 );
+  constexpr T kTwo = T( 2 );
+
+  inplace_vector<T, N> zeros( N, kOne );
+  zeros[ N - 2 ] = kNegZero;
+  zeros[ N - 1 ] = kZero;
+  test( erase( zeros, kZero ) == 2 );
+  test( zeros.size() == N - 2 );
+  inplace_vector<T, N> negZero( N, kOne );
+  negZero.back() = kNegZero;
+  inplace_vector<T, N> posZero( N, kOne );
+  posZero.back() = kZero;
+  test( negZero == posZero );
+  test( ( negZero <=> posZero ) == std::partial_ordering::equivalent );
+
+  inplace_vector<T, N> nan( N, kOne );
+  nan.back() = kNaN;
+  const auto nanCopy = nan; // same bits
+  test( erase( nan, kNaN ) == 0 );
+  test( nan.size() == N );
+  test( nan != nanCopy );
+  test( ( nan <=> nanCopy ) == std::partial_ordering::unordered );
+  test( erase_if( nan, []( T x ) { return x < T( 2 ); } ) == N - 1 ); // NaN < 2 is false
+  test( nan.size() == 1 );
+  test( std::isnan( nan[ 0 ] ) );
+
+  inplace_vector<T, N> denorms( N, kDenorm );
+  denorms.back() = kZero;
+  test( erase( denorms, kZero ) == 1 );
+  test( denorms.size() == N - 1 );
+  inplace_vector<T, N> biggerDenorm( N - 1, kDenorm );
+  biggerDenorm.back() = kDenorm * kTwo;
+  test( denorms != biggerDenorm );
+  test( ( denorms <=> biggerDenorm ) == std::partial_ordering::less );
+}
+
+template <typename T>
+void TestArithmeticKernels( std::mt19937& rng )
+{
+  TestArithmeticKernels<T, 1>( rng );
+  TestArithmeticKernels<T, 7>( rng );
+  TestArithmeticKernels<T, 33>( rng );
+  TestArithmeticKernels<T, 100>( rng );
+  if constexpr ( std::is_floating_point_v<T> )
+  {
+    TestFloatKernelSemantics<T, 7>();
+    TestFloatKernelSemantics<T, 33>();
+  }
+}
+
+// Constant-evaluation mirror of the suite in main() for trivial T. Each static_assert
+// only compiles if every operation it uses is usable in a constant expression.
+
+// default ctor, size, capacity
+static_assert( []
+  {
+    inplace_vector<int, 100> iv;
+    iv.reserve( 10 );
+    iv.shrink_to_fit();
+    return iv.empty() && iv.size() == 0 && iv.capacity() == 100 && iv.max_size() == 100;
+  }() );
+
+// count, count/value, iterator, range, init list, copy and move ctors
+static_assert( []
+  {
+    const auto init = { 1, 2, 3 };
+    inplace_vector<int, 4> ivCount( 3 );
+    inplace_vector<int, 4> ivValue( 3, 42 );
+    inplace_vector<int, 4> ivIter( init.begin(), init.end() );
+    inplace_vector<int, 4> ivRange( std::from_range, init );
+    inplace_vector<int, 4> ivInit( init );
+    inplace_vector<int, 4> ivCopy( ivInit );
+    inplace_vector<int, 4> ivMove( std::move( ivCopy ) );
+    return ivCount.size() == 3 && ivCount[ 1 ] == 0 &&
+           ivValue.size() == 3 && ivValue[ 2 ] == 42 &&
+           ivIter == ivInit && ivRange == ivInit && ivMove == ivInit;
+  }() );
+
+// copy, move and init list assignment; assign(), assign_range()
+static_assert( []
+  {
+    const auto init = { 1, 2, 3 };
+    inplace_vector<int, 4> ivA;
+    inplace_vector<int, 4> ivB( init );
+    ivA = ivB;
+    bool ok = ivA == ivB;
+    ivA = inplace_vector<int, 4>{};
+    ok = ok && ivA.empty();
+    ivA = init;
+    ok = ok && ivA.size() == 3;
+    ivA.assign( 2, 7 );
+    ok = ok && ivA.size() == 2 && ivA[ 1 ] == 7;
+    ivA.assign( init.begin(), init.end() );
+    ok = ok && ivA == ivB;
+    ivA.assign_range( init );
+    return ok && ivA.back() == 3;
+  }() );
+
+// at, operator[], front(), back(), data(), iterators
+static_assert( []
+  {
+    inplace_vector<double, 4> iv{ 1.0, 2.0, 3.0 };
+    return iv.at( 1 ) == 2.0 && iv[ 2 ] == 3.0 && iv.front() == 1.0 && iv.back() == 3.0 &&
+           *iv.data() == 1.0 && *iv.begin() == 1.0 && *( iv.cend() - 1 ) == 3.0 &&
+           *iv.rbegin() == 3.0 && *( iv.crend() - 1 ) == 1.0;
+  }() );
+
+// resize()
+static_assert( []
+  {
+    inplace_vector<int, 10> iv;
+    iv.resize( 5 );
+    iv.resize( 6, 42 );
+    bool ok = iv.size() == 6 && iv[ 4 ] == 0 && iv[ 5 ] == 42;
+    iv.resize( 2 );
+    return ok && iv.size() == 2;
+  }() );
+
+// insert(), insert_range(), emplace()
+static_assert( []
+  {
+    const auto init = { 1, 2, 3 };
+    inplace_vector<int, 13> iv;
+    iv.insert( iv.end(), 5 );
+    iv.insert( iv.begin(), 2, 4 );
+    iv.insert( iv.begin() + 1, init.begin(), init.end() );
+    iv.insert( iv.end(), init );
+    iv.insert_range( iv.begin(), init );
+    iv.emplace( iv.begin() + 3, 9 );
+    constexpr int expected[] = { 1, 2, 3, 9, 4, 1, 2, 3, 4, 5, 1, 2, 3 };
+    return std::ranges::equal( iv, expected ) && iv.size() == 13;
+  }() );
+
+// emplace_back(), push_back() and try_/unchecked_ friends, pop_back()
+static_assert( []
+  {
+    inplace_vector<char, 3> iv;
+    bool ok = iv.emplace_back( 'a' ) == 'a';
+    ok = ok && *iv.try_emplace_back( 'b' ) == 'b';
+    iv.pop_back();
+    ok = ok && iv.unchecked_emplace_back( 'b' ) == 'b';
+    iv.pop_back();
+    ok = ok && iv.push_back( 'b' ) == 'b';
+    ok = ok && iv.unchecked_push_back( 'c' ) == 'c';
+    ok = ok && iv.try_push_back( 'd' ) == nullptr && iv.try_emplace_back( 'd' ) == nullptr;
+    iv.pop_back();
+    const char c = 'c';
+    ok = ok && *iv.try_push_back( c ) == 'c';
+    return ok && iv.size() == 3 && iv[ 0 ] == 'a' && iv[ 2 ] == 'c';
+  }() );
+
+// append_range(), try_append_range()
+static_assert( []
+  {
+    const auto init = { 1, 2, 3 };
+    inplace_vector<int, 4> iv;
+    iv.append_range( init );
+    bool ok = iv.try_append_range( init ) == std::ranges::begin( init ) + 1;
+    ok = ok && iv.try_append_range( init ) == std::ranges::begin( init );
+    return ok && iv.size() == 4 && iv[ 3 ] == 1;
+  }() );
+
+// clear(), erase()
+static_assert( []
+  {
+    inplace_vector<char, 5> iv{ 'a', 'b', 'c', 'd', 'e' };
+    bool ok = *iv.erase( iv.begin() ) == 'b';
+    ok = ok && *iv.erase( iv.begin() + 1 ) == 'd';
+    ok = ok && *iv.erase( iv.begin(), iv.begin() + 1 ) == 'd';
+    ok = ok && iv.size() == 2 && iv.erase( iv.end() - 1 ) == iv.end();
+    iv.clear();
+    return ok && iv.empty();
+  }() );
+
+// swap
+static_assert( []
+  {
+    inplace_vector<int, 5> ivA{ 1, 2, 3, 4, 5 };
+    inplace_vector<int, 5> ivB{ 5, 4 };
+    ivA.swap( ivB );
+    bool ok = ivA.size() == 2 && ivA[ 1 ] == 4 && ivB.size() == 5 && ivB[ 4 ] == 5;
+    std::swap( ivA, ivB );
+    return ok && ivA.size() == 5 && ivB[ 0 ] == 5;
+  }() );
+
+// non-member erase and erase_if
+static_assert( []
+  {
+    inplace_vector<int, 10> iv( 10, 0 );
+    std::ranges::iota( iv, 0 );
+    bool ok = erase( iv, 3 ) == 1;
+    ok = ok && erase_if( iv, []( int x ) { return x % 2 == 0; } ) == 5;
+    constexpr int expected[] = { 1, 5, 7, 9 };
+    return ok && std::ranges::equal( iv, expected );
+  }() );
+
+// comparison
+static_assert( []
+  {
+    inplace_vector<int, 2> ivA{ 1, 2 };
+    inplace_vector<int, 2> ivB{ 1, 2 };
+    bool ok = ivA == ivB && ( ivA <=> ivB ) == 0;
+    ivA[ 0 ] = 2;
+    ok = ok && ivA != ivB && ivA > ivB && ivB < ivA && ivA >= ivB && ivB <= ivA;
+    ivA.pop_back();
+    return ok && ivA > ivB;
+  }() );
+
+// byte-wise comparison falls back to the element-wise loop during constant evaluation
+static_assert( []
+  {
+    inplace_vector<unsigned char, 4> ivA{ 1, 0x80 };
+    inplace_vector<unsigned char, 4> ivB{ 1, 0x7F, 3 };
+    return ivA > ivB && ( ivA <=> ivA ) == 0 && ivB < ivA;
+  }() );
+
+// lookup tables built entirely at compile time
+constexpr auto kPowersOfTwo = []
+  {
+    inplace_vector<uint32_t, 32> table;
+    for ( uint32_t bit = 0; bit < 32; ++bit )
+      table.push_back( 1u << bit );
+    return table;
+  }();
+static_assert( kPowersOfTwo.size() == 32 );
+static_assert( kPowersOfTwo[ 10 ] == 1024 );
+
+constexpr inplace_vector<char, 8> kDelimiters{ ' ', '\t', ',', ';' };
+static_assert( std::ranges::find( kDelimiters, ',' ) != kDelimiters.end() );
+
+// Mirrors the inplace_vector suite in main() for small_vector. Operations that throw
+// bad_alloc on inplace_vector instead spill to the heap; try_ variants never allocate
+// and fail exactly where inplace_vector's do.
+void TestSmallVector()
+{
+  // default ctor, size, capacity
+  {
+    small_vector<int, 100> sv;
+    test( sv.empty() );
+    test( sv.is_inline() );
+    test( sv.size() == 0 );
+    test( sv.capacity() == 100 );
+    sv.reserve( 10 );
+    test( sv.capacity() == 100 );
+    test( sv.is_inline() );
+
+    small_vector<M, 10> svM;
+    test( svM.empty() );
+    test( svM.capacity() == 10 );
+    svM.reserve( 11 ); // spills rather than throwing
+    test( !svM.is_inline() );
+    test( svM.capacity() >= 11 );
+    test( svM.spill_count() == 1 );
+    svM.shrink_to_fit(); // empty again fits inline
+    test( svM.is_inline() );
+    test( svM.capacity() == 10 );
+  }
+
+  // count ctor, count/value ctor, front, back, array access
+  {
+    small_vector<int, 4> sv( 3 );
+    test( sv.size() == 3 );
+    test( sv.front() == 0 );
+    test( sv.back() == 0 );
+    test( sv[ 1 ] == 0 );
+
+    small_vector<M, 4> svM( 3 );
+    test( svM.front() == M{} );
+    test( svM[ 1 ] == M{} );
+
+    small_vector<int, 4> sv42( 3, 42 );
+    test( sv42.size() == 3 );
+    test( sv42[ 1 ] == 42 );
+
+    small_vector<int, 4> svBig( 6, 42 ); // inplace_vector throws
+    test( svBig.size() == 6 );
+    test( !svBig.is_inline() );
+    test( svBig[ 5 ] == 42 );
+  }
+
+  // iterator, range and init list ctors
+  {
+    const auto init = { 1, 2, 3 };
+    small_vector<int, 4> sv( init.begin(), init.end() );
+    test( sv.size() == 3 );
+    test( sv[ 2 ] == 3 );
+
+    small_vector<int, 4> svRange( std::from_range, init );
+    test( svRange.front() == 1 );
+    test( svRange.back() == 3 );
+
+    small_vector<int, 4> svInit( init );
+    test( svInit == sv );
+
+    small_vector<int, 2> svSpill( init ); // inplace_vector throws
+    test( svSpill.size() == 3 );
+    test( !svSpill.is_inline() );
+    test( svSpill[ 2 ] == 3 );
+  }
+
+  // copy and move ctors
+  {
+    small_vector<int, 4> sv( 3, 42 );
+    small_vector<int, 4> sv2( sv );
+    test( sv == sv2 );
+
+    small_vector<M, 4> svM( 3 );
+    small_vector<M, 4> svM2( std::move( svM ) );
+    test( svM.empty() );
+    test( svM2.size() == 3 );
+    test( svM2.front().getStr() == "Initialized"sv );
+
+    small_vector<M, 2> svHeap( 5 );
+    const M* heapData = svHeap.data();
+    small_vector<M, 2> svHeap2( std::move( svHeap ) ); // steals the heap block
+    test( svHeap2.data() == heapData );
+    test( svHeap2.size() == 5 );
+    test( !svHeap2.is_inline() );
+    test( svHeap.empty() );
+    test( svHeap.is_inline() );
+
+    small_vector<M, 2> svHeapCopy( svHeap2 );
+    test( svHeapCopy == svHeap2 );
+  }
+
+  // copy, move and init list assignment
+  {
+    small_vector<M, 10> svEmpty;
+    small_vector<M, 10> svM1;
+    small_vector<M, 10> svM2{ 10, M{ "copied from", 123, 0.11f } };
+    svM1 = svM2;
+    test( svM1 == svM2 );
+    svM2 = svEmpty;
+    test( svM2 == svEmpty );
+
+    small_vector<M, 4> svA{ 2 };
+    small_vector<M, 4> svB{ 2, M{ "sv", 321, 0.22f } };
+    svA = small_vector<M, 4>();
+    test( svA.empty() );
+    svA = std::move( svB );
+    test( svA.size() == 2 );
+    test( svA[ 1 ].getStr() == "sv" );
+    test( svB.empty() );
+
+    const auto init = { M( "a", 1, 2.0f ), M( "b", 3, 4.0f ), M( "c", 5, 6.0f ) };
+    small_vector<M, 2> sv;
+    sv = init;
+    test( sv.size() == 3 );
+    test( !sv.is_inline() );
+    test( sv[ 2 ].getStr() == "c"sv );
+  }
+
+  // assign(), assign_range()
+  {
+    small_vector<M, 4> svA{ 2 };
+    M m{ "m", 1, 2.0f };
+    svA.assign( 1, m );
+    test( svA.size() == 1 );
+    test( svA[ 0 ].getStr() == "m"sv );
+    svA.assign( 5, m );
+    test( svA.size() == 5 );
+    test( svA[ 4 ].getStr() == "m"sv );
+
+    const auto init = { 1, 2, 3 };
+    small_vector<int, 4> sv;
+    sv.assign( std::begin( init ), std::end( init ) );
+    test( sv.size() == 3 );
+    test( sv[ 1 ] == 2 );
+    sv.assign_range( init );
+    test( sv.size() == 3 );
+    test( sv.back() == 3 );
+  }
+
+  // at, operator[], front(), back(), data()
+  {
+    small_vector<M, 5> sv{ 3 };
+    test( sv.at( 0 ).getStr() == "Initialized"sv );
+    test( sv[ 2 ].getStr() == "Initialized"sv );
+    testex( sv.at( 3 ), std::out_of_range&, "small_vector::at"sv );
+
+    M m2{ "b", 1, 2.0f };
+    sv.emplace( std::end( sv ), m2 );
+    test( sv.front() == M{} );
+    test( sv.back() == m2 );
+
+    const int arr[ 3 ] = { 1, 2, 3 };
+    small_vector<int, 2> svI{ 1, 2, 3 };
+    test( memcmp( svI.data(), arr, sizeof( int ) * 3 ) == 0 ); // contiguous once spilled
+  }
+
+  // iterators
+  {
+    const auto init = { 1.0, 2.0, 3.0 };
+    small_vector<double, 4> sv( init );
+    test( sv.begin() == sv.cbegin() );
+    test( *sv.begin() == 1.0 );
+    test( *( sv.end() - 1 ) == 3.0 );
+    test( *sv.rbegin() == 3.0 );
+    test( *( sv.crend() - 1 ) == 1.0 );
+  }
+
+  // resize()
+  {
+    small_vector<M, 4> sv;
+    sv.resize( 1 );
+    test( sv.front().getStr() == "Initialized"sv );
+    M mA{ "a", 0, 1.0f };
+    sv.resize( 6, mA ); // spills
+    test( sv.size() == 6 );
+    test( !sv.is_inline() );
+    test( sv[ 0 ].getStr() == "Initialized"sv );
+    test( sv[ 5 ].getStr() == "a" );
+    sv.resize( 2 );
+    test( sv.size() == 2 );
+    test( !sv.is_inline() ); // like std::vector, capacity is kept until shrink_to_fit
+    sv.shrink_to_fit();
+    test( sv.is_inline() );
+    test( sv[ 1 ].getStr() == "a" );
+  }
+
+  // insert() and insert_range()
+  {
+    small_vector<M, 4> sv;
+    M mA{ "a", 0, 1.0f };
+    M mB{ "b", 2, 3.0f };
+    M mC{ "c", 4, 5.0f };
+    test( sv.insert( sv.end(), mA )->getStr() == "a"sv );
+    test( sv.insert( sv.begin(), mB )->getStr() == "b"sv );
+    test( sv.insert( sv.begin() + 1, mC )->getStr() == "c"sv );
+    test( sv.insert( sv.begin(), 3, M{} )->getStr() == "Initialized"sv ); // spills
+    test( sv.size() == 6 );
+    test( sv[ 2 ].getStr() == "Initialized"sv );
+    test( sv[ 3 ].getStr() == "b" );
+    test( sv[ 4 ].getStr() == "c" );
+    test( sv[ 5 ].getStr() == "a" );
+
+    small_vector<int, 4> svI;
+    const auto init = { 1, 2, 3 };
+    test( *( svI.insert( svI.end(), init.begin(), init.end() ) ) == 1 );
+    test( *( svI.insert( svI.begin() + 2, init ) ) == 1 );
+    test( svI.size() == 6 );
+    test( std::ranges::equal( svI, std::array{ 1, 2, 1, 2, 3, 3 } ) );
+    svI.insert_range( svI.begin() + 1, init );
+    test( svI.size() == 9 );
+    test( std::ranges::equal( svI, std::array{ 1, 1, 2, 3, 2, 1, 2, 3, 3 } ) );
+  }
+
+  // emplace(), emplace_back(), try_emplace_back(), unchecked_emplace_back()
+  {
+    small_vector<char, 3> sv;
+    test( sv.emplace( sv.end(), 'a' ) == sv.begin() );
+    test( sv.emplace_back( 'b' ) == 'b' );
+    test( *sv.try_emplace_back( 'c' ) == 'c' );
+    test( sv.try_emplace_back( 'd' ) == nullptr ); // try_ never allocates
+    test( sv.is_inline() );
+    test( sv.emplace_back( 'd' ) == 'd' );
+    test( !sv.is_inline() );
+    test( sv.size() == 4 );
+
+    small_vector<char, 3> svU;
+    test( svU.unchecked_emplace_back( 'a' ) == 'a' );
+    test( svU.unchecked_emplace_back( 'b' ) == 'b' );
+    test( svU[ 1 ] == 'b' );
+  }
+
+  // push_back() and friends, pop_back()
+  {
+    small_vector<char, 3> sv;
+    char b = 'b';
+    test( sv.push_back( 'a' ) == 'a' );
+    test( *sv.try_push_back( b ) == 'b' );
+    test( sv.unchecked_push_back( 'c' ) == 'c' );
+    test( sv.try_push_back( 'd' ) == nullptr );
+    test( sv.push_back( 'e' ) == 'e' ); // spills
+    test( sv.size() == 4 );
+    test( sv.capacity() >= 4 );
+    sv.reserve( 8 );
+    test( *sv.try_push_back( 'f' ) == 'f' ); // room on the heap
+    sv.pop_back();
+    test( sv[ 3 ] == 'e' );
+
+    small_vector<M, 2> svm;
+    M mA{ "a", 0, 1.0f };
+    test( svm.push_back( mA ) == mA );
+    svm.pop_back();
+    test( svm.empty() );
+  }
+
+  // append_range(), try_append_range()
+  {
+    const auto init = { 1, 2, 3 };
+    small_vector<int, 4> sv;
+    sv.append_range( init );
+    test( sv.try_append_range( init ) == std::ranges::begin( init ) + 1 );
+    test( sv.size() == 4 );
+    test( sv.is_inline() );
+    sv.append_range( init ); // spills
+    test( sv.size() == 7 );
+    test( sv[ 6 ] == 3 );
+  }
+
+  // clear(), erase()
+  {
+    small_vector<M, 2> svm;
+    const auto init = { M{ "a", 0, 1.0f },
+                        M{ "b", 0, 1.0f },
+                        M{ "c", 0, 1.0f },
+                        M{ "d", 0, 1.0f },
+                        M{ "e", 0, 1.0f } };
+    svm.append_range( init );
+    test( svm.erase( svm.begin() )->getStr() == "b"sv );
+    test( svm.erase( svm.begin() + 1 )->getStr() == "d"sv );
+    test( svm.size() == 3 );
+    test( svm.erase( svm.begin() + 1, svm.end() ) == svm.end() );
+    test( svm.size() == 1 );
+    test( svm[ 0 ].getStr() == "b"sv );
+    svm.clear();
+    test( svm.empty() );
+  }
+
+  // swap: inline/inline, inline/heap, heap/heap
+  {
+    small_vector<int, 3> svA{ 1, 2 };
+    small_vector<int, 3> svB{ 5, 4, 3, 2, 1 };
+    svA.swap( svB );
+    test( svA.size() == 5 );
+    test( !svA.is_inline() );
+    test( svA[ 0 ] == 5 );
+    test( svB.size() == 2 );
+    test( svB.is_inline() );
+    test( svB[ 1 ] == 2 );
+
+    small_vector<M, 2> svm{ { M{ "a", 1, 1.0f }, M{ "b", 2, 2.0f } } };
+    small_vector<M, 2> svm2{ { M{ "x", 3, 3.0f }, M{ "y", 4, 4.0f } } };
+    std::swap( svm, svm2 );
+    test( svm[ 0 ].getStr() == "x"sv );
+    test( svm2[ 1 ].getStr() == "b"sv );
+  }
+
+  // non-member erase and erase_if, comparison
+  {
+    small_vector<int, 4> sv( 10, 0 );
+    std::ranges::iota( sv, 0 );
+    test( erase( sv, 3 ) == 1 );
+    test( erase_if( sv, []( int x ) { return x % 2 == 0; } ) == 5 );
+    test( std::ranges::equal( sv, std::array{ 1, 5, 7, 9 } ) );
+
+    small_vector<int, 2> svA{ 1, 2 };
+    small_vector<int, 2> svB{ 1, 2, 3 };
+    test( svA != svB );
+    test( svA < svB );
+    svB.pop_back();
+    test( svA == svB ); // inline vs. heap storage compares by contents
+  }
+
+  // counters
+  {
+    small_vector<int, 2> sv;
+    test( sv.spill_count() == 0 );
+    test( sv.peak_size() == 0 );
+    sv.append_range( std::array{ 1, 2, 3 } );
+    test( sv.spill_count() == 1 );
+    test( sv.peak_size() == 3 );
+    sv.clear();
+    sv.shrink_to_fit();
+    sv.append_range( std::array{ 1, 2, 3, 4, 5 } );
+    test( sv.spill_count() == 2 );
+    test( sv.peak_size() == 5 );
+  }
+}
+
 int __cdecl main()
 {
   // inplace_vector<void, 10> voidvec;
@@ -189,7 +1274,8 @@ int __cdecl main()
   // copy ctor
   {
     inplace_vector<int, 4> iv( 3, 42 );
-    // inplace_vector<int, 5> ivx( iv ); // compiler error
+    inplace_vector<int, 5> ivx( iv ); // converts across capacities
+    test( ivx == iv );
     inplace_vector<int, 4> iv2( iv );
     test( iv == iv2 );
   }
@@ -198,8 +1284,7 @@ int __cdecl main()
   {
     inplace_vector<int, 4> iv( 3, 42 );
     inplace_vector<int, 4> iv2( std::move(iv) );
-    test( iv.empty() );
-    test( iv != iv2 );
+    test( iv == iv2 ); // trivially copyable; moving is copying
     test( iv2.size() == 3 );
     test( iv2.capacity() == 4 );
     test( iv2.front() == 42 );
@@ -217,6 +1302,104 @@ int __cdecl main()
     test( ivM2[ 1 ] == M{} );
   }
 
+  // cross-capacity construction, assignment, swap_contents, comparison and append_range
+  {
+    using iv4 = inplace_vector<int, 4>;
+    using iv8 = inplace_vector<int, 8>;
+
+    // widening always fits, so it is implicit; narrowing is explicit and checks size()
+    static_assert( std::is_convertible_v<const iv4&, iv8> );
+    static_assert( std::is_convertible_v<iv4&&, iv8> );
+    static_assert( !std::is_convertible_v<const iv8&, iv4> );
+    static_assert( std::is_constructible_v<iv4, const iv8&> );
+    static_assert( !std::is_constructible_v<inplace_vector<long, 8>, const iv4&> ); // same T only
+
+    const iv4 small{ 1, 2, 3 };
+    iv8 wide = small;
+    test( wide.size() == 3 );
+    test( wide == small );
+    test( ( wide <=> small ) == std::strong_ordering::equal );
+    wide.push_back( 4 );
+    test( wide != small );
+    test( wide > small );
+    test( small < wide );
+
+    iv4 narrow( wide ); // 4 elements fit
+    test( narrow == wide );
+    wide.push_back( 5 );
+    testex( iv4( wide ), std::bad_alloc, "bad allocation"sv );
+
+    iv4 assigned{ 9 };
+    testex( assigned = wide, std::bad_alloc, "bad allocation"sv );
+    test( assigned == iv4{ 9 } ); // strong guarantee
+    test( !assigned.try_assign( wide ) );
+    test( assigned == iv4{ 9 } );
+    wide.pop_back();
+    test( assigned.try_assign( wide ) );
+    test( assigned == wide );
+    wide.assign( { 7, 8 } );
+    assigned = wide;
+    test( assigned == iv4( { 7, 8 } ) );
+
+    // move; M is not trivially copyable, so elements are moved one by one
+    inplace_vector<M, 2> ivM{ M{ "a", 1, 1.0f }, M{ "b", 2, 2.0f } };
+    inplace_vector<M, 6> ivM6( std::move( ivM ) );
+    test( ivM.empty() );
+    test( ivM6.size() == 2 );
+    test( ivM6[ 1 ].getStr() == "b"sv );
+    ivM6.push_back( M{} );
+    testex( ivM = std::move( ivM6 ), std::bad_alloc, "bad allocation"sv );
+    test( ivM6.size() == 3 ); // nothing moved out
+    ivM6.pop_back();
+    ivM = std::move( ivM6 );
+    test( ivM.size() == 2 );
+    test( ivM[ 0 ].getStr() == "a"sv );
+
+    // swap_contents; throws, changing neither side, unless both fit
+    iv4 left{ 1, 2 };
+    iv8 right{ 3, 4, 5 };
+    left.swap_contents( right );
+    test( left == iv4( { 3, 4, 5 } ) );
+    test( right == iv8( { 1, 2 } ) );
+    right.assign( { 1, 2, 3, 4, 5 } );
+    testex( left.swap_contents( right ), std::bad_alloc, "bad allocation"sv );
+    test( left == iv4( { 3, 4, 5 } ) );
+    test( right.size() == 5 );
+
+    // append_range from another capacity
+    iv8 joined{ 0 };
+    joined.append_range( small );
+    joined.append_range( iv4{ 4, 5 } );
+    test( joined == iv8( { 0, 1, 2, 3, 4, 5 } ) );
+    testex( joined.append_range( iv4{ 6, 7, 8 } ), std::bad_alloc, "bad allocation"sv );
+    test( joined.size() == 6 );
+  }
+
+  // trivially copyable
+  {
+    static_assert( std::is_trivially_copyable_v<inplace_vector<int, 4>> );
+    static_assert( std::is_trivially_copyable_v<inplace_vector<double, 100>> );
+    static_assert( std::is_trivially_copyable_v<inplace_vector<M, 0>> );
+    static_assert( !std::is_trivially_copyable_v<inplace_vector<M, 4>> );
+
+    const auto init = { 1.0, 2.0, 3.0 };
+    inplace_vector<double, 4> iv( init );
+    inplace_vector<double, 4> ivCopy( iv );
+    test( ivCopy == iv );
+    inplace_vector<double, 4> ivMove( std::move( ivCopy ) );
+    test( ivMove == iv );
+
+    inplace_vector<double, 4> ivAssign{ 9.0 };
+    ivAssign = iv;
+    test( ivAssign == iv );
+    ivAssign = inplace_vector<double, 4>{};
+    test( ivAssign.empty() );
+    ivAssign.swap( iv );
+    test( iv.empty() );
+    test( ivAssign.size() == 3 );
+    test( ivAssign[ 2 ] == 3.0 );
+  }
+
   // init list ctor
   {
     const auto init = { 1, 2, 3 };
@@ -362,7 +1545,7 @@ int __cdecl main()
     test( iv[0].getStr() == "Initialized"sv );
     test( constOpBracket( iv, 1 ).getStr() == "Initialized"sv );
 
-    // iv[3]; // asserts
+    // iv[3]; // asserts; see TestContracts.cpp
     // constOpBracket( iv, 3 ); // asserts
   }
 
@@ -428,6 +1611,148 @@ int __cdecl main()
     test( memcmp( constData( iv ), arr, sizeof( int ) * 3 ) == 0 );
   }
 
+  // write_to(), read_from() binary format round trip
+  {
+    inplace_vector<int, 8> iv{ 1, 2, 3 };
+    alignas( 16 ) std::array<std::byte, 128> buffer{};
+    const auto bytes = iv.write_to( buffer );
+    test( bytes == iv.serialized_size() );
+    test( bytes > sizeof( int ) * 3 ); // header holds version, size, capacity, element size, endianness
+    test( iv.write_to( std::span( buffer ).first( bytes - 1 ) ) == 0 ); // buffer too small
+
+    // payload follows the header and is the memory image of data()
+    test( memcmp( buffer.data() + bytes - sizeof( int ) * 3, iv.data(), sizeof( int ) * 3 ) == 0 );
+
+    const auto image = std::span<const std::byte>( buffer ).first( bytes );
+    inplace_vector<int, 8> copy;
+    test( copy.read_from( image ) );
+    test( copy == iv );
+    inplace_vector<int, 4> smaller; // capacity may differ as long as size() fits
+    test( smaller.read_from( image ) );
+    test( std::ranges::equal( smaller, iv ) );
+
+    inplace_vector<int, 2> tiny{ 9 };
+    test( !tiny.read_from( image ) ); // failures leave the target unchanged
+    test( tiny.size() == 1 );
+    test( tiny[ 0 ] == 9 );
+    inplace_vector<double, 8> wrongType;
+    test( !wrongType.read_from( image ) ); // element size mismatch
+    test( !copy.read_from( image.first( bytes - 1 ) ) ); // truncated
+    test( copy == iv );
+
+    auto corrupt = buffer;
+    corrupt[ 0 ] ^= std::byte{ 0xFF }; // magic
+    test( !copy.read_from( std::span<const std::byte>( corrupt ).first( bytes ) ) );
+
+    inplace_vector<int, 8> empty;
+    const auto emptyBytes = empty.write_to( buffer );
+    test( emptyBytes == empty.serialized_size() );
+    test( copy.read_from( std::span<const std::byte>( buffer ).first( emptyBytes ) ) );
+    test( copy.empty() );
+  }
+
+  // inplace_vector_view maps serialized bytes without copying
+  {
+    inplace_vector<double, 8> iv{ 1.5, 2.5 };
+    alignas( 16 ) std::array<std::byte, 128> buffer{};
+    const auto bytes = iv.write_to( buffer );
+    const auto image = std::span<const std::byte>( buffer ).first( bytes );
+
+    inplace_vector_view<const double, 8> view( image );
+    test( view.valid() );
+    test( view.size() == 2 );
+    test( view.capacity() == 8 );
+    test( view[ 1 ] == 2.5 );
+    test( std::ranges::equal( view, iv ) );
+    test( reinterpret_cast<const std::byte*>( view.data() ) == buffer.data() + bytes - sizeof( double ) * 2 );
+
+    inplace_vector_view<const double, 1> tooSmall( image );
+    test( !tooSmall.valid() );
+    test( tooSmall.empty() );
+
+    alignas( 16 ) std::array<std::byte, 129> shifted{};
+    memcpy( shifted.data() + 1, buffer.data(), bytes );
+    inplace_vector_view<const double, 8> misaligned( std::span<const std::byte>( shifted ).subspan( 1, bytes ) );
+    test( !misaligned.valid() ); // a view never reads unaligned elements
+  }
+
+  // layout; size is stored in the smallest unsigned type that holds N
+  {
+    static_assert( std::is_same_v<inplace_vector<char, 3>::size_type, size_t> );
+
+    static_assert( sizeof( inplace_vector<char, 3> ) == 4 );
+    static_assert( alignof( inplace_vector<char, 3> ) == 1 );
+    static_assert( sizeof( inplace_vector<char, 255> ) == 256 );
+    static_assert( sizeof( inplace_vector<char, 256> ) == 258 );
+    static_assert( alignof( inplace_vector<char, 256> ) == alignof( uint16_t ) );
+    static_assert( sizeof( inplace_vector<char, 65536> ) == 65540 );
+    static_assert( alignof( inplace_vector<char, 65536> ) == alignof( uint32_t ) );
+
+    static_assert( sizeof( inplace_vector<int, 4> ) == 20 );
+    static_assert( alignof( inplace_vector<int, 4> ) == alignof( int ) );
+    static_assert( sizeof( inplace_vector<double, 4> ) == 40 );
+    static_assert( alignof( inplace_vector<double, 4> ) == alignof( double ) );
+
+    struct Packed
+    {
+      inplace_vector<char, 3> iv;
+      char c;
+    };
+    static_assert( sizeof( Packed ) == 5 );
+  }
+
+  // aligned_inplace_vector; storage on an Align boundary, size in its own Align-sized
+  // slot after the elements. The size lands on a different cache line from the elements
+  // only when Align is at least the line size; at Align = 32 the 64-byte double[ 4 ]
+  // vector fits in a single line, size included.
+  {
+    static_assert( std::is_same_v<aligned_inplace_vector<float, 16>,
+                                  inplace_vector<float, 16, inplace_vector_no_stats, 64>> );
+    static_assert( alignof( aligned_inplace_vector<float, 16> ) == 64 );
+    static_assert( sizeof( aligned_inplace_vector<float, 16> ) == 128 );
+    static_assert( sizeof( aligned_inplace_vector<float, 3> ) == 128 );
+    static_assert( alignof( aligned_inplace_vector<double, 4, 32> ) == 32 );
+    static_assert( sizeof( aligned_inplace_vector<double, 4, 32> ) == 64 );
+    static_assert( alignof( aligned_inplace_vector<char, 100, 128> ) == 128 );
+    static_assert( sizeof( aligned_inplace_vector<char, 100, 128> ) == 256 );
+
+    auto isAligned = []( const auto& iv, uintptr_t align )
+      {
+        return reinterpret_cast<uintptr_t>( iv.data() ) % align == 0;
+      };
+
+    // stack, members of an array, heap
+    aligned_inplace_vector<float, 16> ivF( 16, 1.0f );
+    test( isAligned( ivF, 64 ) );
+    aligned_inplace_vector<double, 4, 32> ivArr[ 3 ];
+    for ( const auto& iv : ivArr )
+      test( isAligned( iv, 32 ) );
+    auto ivHeap = std::make_unique<aligned_inplace_vector<char, 100, 128>>( 100, 'x' );
+    test( isAligned( *ivHeap, 128 ) );
+    std::vector<aligned_inplace_vector<float, 3>> ivVec( 5 );
+    for ( const auto& iv : ivVec )
+      test( isAligned( iv, 64 ) );
+
+    // otherwise behaves like inplace_vector
+    test( ivF.size() == 16 );
+    test( std::accumulate( ivF.begin(), ivF.end(), 0.0f ) == 16.0f );
+    testex( ivF.push_back( 2.0f ), std::bad_alloc, "bad allocation"sv );
+    ivF.resize( 4 );
+    aligned_inplace_vector<float, 16> ivF2( ivF );
+    test( ivF2 == ivF );
+    test( isAligned( ivF2, 64 ) );
+
+    aligned_inplace_vector<float, 16> ivG{ 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f };
+    ivG.swap( ivF );
+    test( ivF.size() == 6 );
+    test( ivF.front() == 2.0f );
+    test( ivF.back() == 7.0f );
+    test( ivG.size() == 4 );
+    test( ivG == ivF2 );
+    test( isAligned( ivF, 64 ) );
+    test( isAligned( ivG, 64 ) );
+  }
+
   // Iterators
   {
     const auto init = { 1.0, 2.0, 3.0 };
@@ -520,6 +1845,72 @@ int __cdecl main()
     testex( iv.resize( 10 + 1, mA ), std::bad_alloc, "bad allocation"sv );
   }
 
+  // resize_default_init()
+  {
+    inplace_vector<int, 8> iv{ 1, 2 };
+    iv.resize_default_init( 6 ); // new ints are left uninitialized
+    test( iv.size() == 6 );
+    test( iv[ 0 ] == 1 );
+    test( iv[ 1 ] == 2 );
+    std::ranges::iota( iv, 10 );
+    test( iv[ 5 ] == 15 );
+    iv.resize_default_init( 3 );
+    test( iv.size() == 3 );
+    test( iv[ 2 ] == 12 );
+    testex( iv.resize_default_init( 9 ), std::bad_alloc, "bad allocation"sv );
+    test( iv.size() == 3 );
+
+    inplace_vector<M, 4> ivM{ M{ "a", 1, 1.0f } };
+    ivM.resize_default_init( 3 ); // non-trivial elements are default constructed
+    test( ivM.size() == 3 );
+    test( ivM[ 0 ].getStr() == "a"sv );
+    test( ivM[ 1 ] == M{} );
+    test( ivM[ 2 ] == M{} );
+    ivM.resize_default_init( 1 );
+    test( ivM.size() == 1 );
+    test( ivM[ 0 ].getStr() == "a"sv );
+  }
+
+  // resize_and_overwrite()
+  {
+    inplace_vector<int, 8> iv{ 1, 2 };
+    iv.resize_and_overwrite( 6, []( int* p, size_t n )
+      {
+        test( n == 6 );
+        test( p[ 0 ] == 1 );
+        test( p[ 1 ] == 2 );
+        for ( size_t i = 2; i < 5; ++i )
+          p[ i ] = static_cast<int>( i * 10 );
+        return size_t{ 5 }; // like recv(), may deliver less than requested
+      } );
+    test( iv.size() == 5 );
+    test( iv[ 1 ] == 2 );
+    test( iv[ 2 ] == 20 );
+    test( iv[ 4 ] == 40 );
+
+    iv.resize_and_overwrite( 3, []( int*, size_t n ) { return n; } ); // shrink
+    test( iv.size() == 3 );
+    test( iv[ 2 ] == 20 );
+    iv.resize_and_overwrite( 8, []( int*, size_t ) { return size_t{ 0 }; } );
+    test( iv.empty() );
+    testex( iv.resize_and_overwrite( 9, []( int*, size_t n ) { return n; } ),
+            std::bad_alloc, "bad allocation"sv );
+    test( iv.empty() );
+
+    inplace_vector<M, 4> ivM{ M{ "a", 1, 1.0f } };
+    ivM.resize_and_overwrite( 3, []( M* p, size_t n )
+      {
+        test( n == 3 );
+        test( p[ 0 ].getStr() == "a"sv );
+        test( p[ 1 ] == M{} ); // non-trivial elements are default constructed first
+        p[ 1 ] = M{ "b", 2, 2.0f };
+        return size_t{ 2 }; // p[ 2 ] is destroyed
+      } );
+    test( ivM.size() == 2 );
+    test( ivM[ 0 ].getStr() == "a"sv );
+    test( ivM[ 1 ].getStr() == "b"sv );
+  }
+
   // insert() and insert_range()
   {
     using ivM = inplace_vector<M, 10>;
@@ -629,6 +2020,115 @@ int __cdecl main()
     test( ivI.size() == 9 );
   }
 
+  // insert_range() and insert( pos, first, last ) shift the tail once for forward ranges;
+  // input-only ranges are appended then rotated into place
+  {
+    using ivC = inplace_vector<Counted, 16>;
+    const std::array<Counted, 3> src{ Counted{ 7 }, Counted{ 8 }, Counted{ 9 } };
+    ivC iv{ Counted{ 1 }, Counted{ 2 }, Counted{ 3 }, Counted{ 4 }, Counted{ 5 }, Counted{ 6 } };
+    Counted::reset();
+
+    // 4 after pos; the last 3 move to the new end, 1 shifts, 3 are assigned
+    iv.insert_range( iv.begin() + 2, src );
+    Counted::expect( { .moveCtor = 3, .copyAssign = 3, .moveAssign = 1 } );
+    iv.insert( iv.begin() + 4, src.begin(), src.end() ); // 5 after
+    Counted::expect( { .moveCtor = 3, .copyAssign = 3, .moveAssign = 2 } );
+
+    // 1 after pos; 2 are built past the end, 1 moves, 1 is assigned
+    iv.insert_range( iv.end() - 1, src );
+    Counted::expect( { .copyCtor = 2, .moveCtor = 1, .copyAssign = 1 } );
+
+    // sized but not random access; the capacity check comes before any element is built
+    std::list<Counted> list( src.begin(), src.end() );
+    Counted::reset();
+    testex( iv.insert_range( iv.begin(), list ), std::bad_alloc, "bad allocation"sv );
+    Counted::expect( {} );
+
+    // forward but not sized; still measured up front and shifted once
+    std::forward_list<Counted> fwd( src.begin(), src.end() );
+    static_assert( std::ranges::forward_range<decltype( fwd )> && !std::ranges::sized_range<decltype( fwd )> );
+    Counted::reset();
+    testex( iv.insert_range( iv.begin(), fwd ), std::bad_alloc, "bad allocation"sv );
+    Counted::expect( {} );
+    iv.pop_back();
+    iv.pop_back();
+    Counted::reset();
+    iv.insert_range( iv.begin() + 12, fwd );
+    Counted::expect( { .copyCtor = 2, .moveCtor = 1, .copyAssign = 1 } );
+
+    constexpr std::array expected{ 1, 2, 7, 8, 7, 8, 9, 9, 3, 4, 5, 7, 7, 8, 9, 8 };
+    test( iv.size() == expected.size() );
+    for ( size_t i = 0; i < expected.size(); ++i )
+      test( iv[ i ].get() == expected[ i ] );
+
+    using ivM = inplace_vector<M, 8>;
+    ivM ivm{ M{ "a", 1, 1.0f }, M{ "b", 2, 2.0f } };
+    const std::vector<M> ms{ M{ "x", 3, 3.0f }, M{ "y", 4, 4.0f }, M{ "z", 5, 5.0f } };
+    test( ivm.insert_range( ivm.begin() + 1, ms )->getStr() == "x"sv );
+    test( ivm.size() == 5 );
+    test( ivm[ 0 ].getStr() == "a"sv );
+    test( ivm[ 3 ].getStr() == "z"sv );
+    test( ivm[ 4 ] == M( "b", 2, 2.0f ) );
+
+    // input-only range; appended, then rotated into place
+    std::istringstream in( "1 2 3" );
+    auto parsed = std::views::istream<int>( in ) |
+      std::views::transform( []( int i ) { return M{ "p", i, 0.0f }; } );
+    test( ivm.insert_range( ivm.begin() + 1, parsed )->getStr() == "p"sv );
+    test( ivm.size() == 8 );
+    test( ivm[ 0 ].getStr() == "a"sv );
+    test( ivm[ 1 ] == M( "p", 1, 0.0f ) );
+    test( ivm[ 3 ] == M( "p", 3, 0.0f ) );
+    test( ivm[ 4 ].getStr() == "x"sv );
+    test( ivm[ 7 ] == M( "b", 2, 2.0f ) );
+
+    // input range overflow; the appended tail is rolled back, leaving ivm untouched
+    ivm.pop_back();
+    std::istringstream in2( "4 5" );
+    auto overflow = std::views::istream<int>( in2 ) |
+      std::views::transform( []( int i ) { return M{ "q", i, 0.0f }; } );
+    testex( ivm.insert_range( ivm.begin(), overflow ), std::bad_alloc, "bad allocation"sv );
+    test( ivm.size() == 7 );
+    test( ivm[ 0 ].getStr() == "a"sv );
+    test( ivm[ 6 ].getStr() == "z"sv );
+  }
+
+  // insert_range(), append_range() exception safety with a throwing copy constructor
+  {
+    using ivT = inplace_vector<ThrowOnCopy, 8>;
+    const std::array<ThrowOnCopy, 3> src{ ThrowOnCopy{ 7 }, ThrowOnCopy{ 8 }, ThrowOnCopy{ 9 } };
+    const auto outside = ThrowOnCopy::live;
+    {
+      ivT iv;
+      for ( int i = 0; i < 5; ++i )
+        iv.emplace_back( i );
+
+      // middle insert; basic guarantee: size() and the live count stay consistent
+      ThrowOnCopy::copiesUntilThrow = 1;
+      testex( iv.insert_range( iv.begin() + 1, src ), std::runtime_error, "ThrowOnCopy"sv );
+      ThrowOnCopy::copiesUntilThrow = -1;
+      test( iv.size() >= 5 );
+      test( iv.size() <= 8 );
+      test( ThrowOnCopy::live == outside + static_cast<int>( iv.size() ) );
+      test( iv[ 0 ].get() == 0 );
+
+      // at the end; strong guarantee: the partially appended elements are destroyed
+      iv.resize( 5, ThrowOnCopy{ 0 } );
+      const std::vector<int> before{ iv[ 0 ].get(), iv[ 1 ].get(), iv[ 2 ].get(),
+                                     iv[ 3 ].get(), iv[ 4 ].get() };
+      ThrowOnCopy::copiesUntilThrow = 2;
+      testex( iv.append_range( src ), std::runtime_error, "ThrowOnCopy"sv );
+      ThrowOnCopy::copiesUntilThrow = 2;
+      testex( iv.insert_range( iv.end(), src ), std::runtime_error, "ThrowOnCopy"sv );
+      ThrowOnCopy::copiesUntilThrow = -1;
+      test( iv.size() == 5 );
+      for ( size_t i = 0; i < before.size(); ++i )
+        test( iv[ i ].get() == before[ i ] );
+      test( ThrowOnCopy::live == outside + 5 );
+    }
+    test( ThrowOnCopy::live == outside );
+  }
+
   // emplace()
   {
     using ivC = inplace_vector<char, 3>;
@@ -807,6 +2307,188 @@ int __cdecl main()
     test( iv.try_append_range( emptyRange ) == std::ranges::end( emptyRange ) );
   }
 
+  // append_n(), try_append_n()
+  {
+    inplace_vector<int, 8> iv{ 1 };
+    auto square = []( size_t i ) { return static_cast<int>( i * i ); };
+    iv.append_n( 4, square );
+    test( iv.size() == 5 );
+    test( std::ranges::equal( iv, std::array{ 1, 0, 1, 4, 9 } ) );
+    iv.append_n( 0, square );
+    test( iv.size() == 5 );
+
+    size_t calls = 0;
+    auto counted = [&calls]( size_t i ) { ++calls; return static_cast<int>( i ); };
+    testex( iv.append_n( 4, counted ), std::bad_alloc, "bad allocation"sv );
+    test( calls == 0 ); // one capacity check up front; nothing constructed
+    test( iv.size() == 5 );
+
+    test( iv.try_append_n( 4, counted ) == 3 ); // fills the spare capacity
+    test( calls == 3 );
+    test( iv.size() == 8 );
+    test( iv[ 7 ] == 2 );
+    test( iv.try_append_n( 4, counted ) == 0 );
+    test( calls == 3 );
+
+    using ivM = inplace_vector<M, 5>;
+    ivM ivm;
+    ivm.append_n( 2, []( size_t i ) { return M{ std::string( 1, static_cast<char>( 'a' + i ) ), 0, 1.0f }; } );
+    test( ivm.size() == 2 );
+    test( ivm[ 1 ].getStr() == "b"sv );
+
+    // a throwing generator rolls back what it appended; strong guarantee, as append_range
+    auto throwsThird = []( size_t i )
+      {
+        if ( i == 2 )
+          throw std::runtime_error( "generator" );
+        return M{ "g", static_cast<int>( i ), 1.0f };
+      };
+    testex( ivm.append_n( 3, throwsThird ), std::runtime_error, "generator"sv );
+    test( ivm.size() == 2 );
+    test( ivm[ 0 ].getStr() == "a"sv );
+    test( ivm[ 1 ].getStr() == "b"sv );
+    test( ivm.try_append_n( 2, throwsThird ) == 2 ); // i == 0, 1; never reaches the throw
+    test( ivm.size() == 4 );
+    test( ivm[ 3 ] == M( "g", 1, 1.0f ) );
+    test( ivm.try_append_n( 3, throwsThird ) == 1 ); // only i == 0 fits
+    test( ivm.size() == 5 );
+  }
+
+  // spare_capacity(), commit()
+  {
+    inplace_vector<char, 16> iv{ 'a', 'b' };
+    std::span<char> spare = iv.spare_capacity();
+    test( spare.size() == 14 );
+    test( spare.data() == iv.data() + 2 );
+    memcpy( spare.data(), "cde", 3 ); // stand-in for recv() or fread()
+    iv.commit( 3 );
+    test( iv.size() == 5 );
+    test( iv[ 2 ] == 'c' );
+    test( iv[ 4 ] == 'e' );
+    test( iv.spare_capacity().size() == 11 );
+
+    iv.commit( 0 );
+    test( iv.size() == 5 );
+    testex( iv.commit( 12 ), std::bad_alloc, "bad allocation"sv );
+    test( iv.size() == 5 );
+
+    inplace_vector<char, 2> full{ 'x', 'y' };
+    test( full.spare_capacity().empty() );
+  }
+
+  // append_from() FILE* and file descriptor
+  {
+    FILE* file = nullptr;
+    test( tmpfile_s( &file ) == 0 );
+    const auto text = "packet payload"sv;
+    test( fwrite( text.data(), 1, text.size(), file ) == text.size() );
+    rewind( file );
+
+    inplace_vector<std::byte, 8> packet{ std::byte{ '>' } };
+    test( packet.append_from( file ) == 7 ); // reads only into spare capacity
+    test( packet.size() == 8 );
+    test( packet[ 1 ] == std::byte{ 'p' } );
+    test( packet[ 7 ] == std::byte{ ' ' } );
+    test( packet.append_from( file ) == 0 ); // full
+    packet.clear();
+    test( packet.append_from( file ) == 7 );
+    test( packet[ 6 ] == std::byte{ 'd' } );
+    packet.clear();
+    test( packet.append_from( file ) == 0 ); // end of file
+    test( packet.empty() );
+
+    rewind( file );
+    inplace_vector<char, 64> line;
+    test( line.append_from( _fileno( file ) ) == static_cast<ptrdiff_t>( text.size() ) );
+    test( std::string_view( line.data(), line.size() ) == text );
+    test( line.append_from( _fileno( file ) ) == 0 ); // end of file
+    test( line.size() == text.size() );
+    fclose( file );
+  }
+
+  // async_fill(), async_drain()
+  {
+    inplace_vector<std::byte, 8> frame{ std::byte{ '>' } };
+    ChunkSource source{ "packet payload"sv };
+    test( sync_wait( async_fill( frame, source ) ) == 7 ); // stops when spare capacity is full
+    test( frame.size() == 8 );
+    test( frame[ 1 ] == std::byte{ 'p' } );
+    test( frame[ 7 ] == std::byte{ ' ' } );
+
+    ChunkSink sink;
+    test( sync_wait( async_drain( frame, sink ) ) == 8 ); // drains across partial writes
+    test( frame.empty() );
+    test( sink.received == ">packet "sv );
+
+    test( sync_wait( async_fill( frame, source ) ) == 7 ); // source drained
+    test( frame.size() == 7 );
+    test( sync_wait( async_fill( frame, source ) ) == 0 );
+    test( sync_wait( async_drain( frame, sink ) ) == 7 );
+    test( sink.received == ">packet payload"sv );
+
+    // suspends on every pending read and resumes where it left off
+    ChunkSource manual{ "0123456789"sv, 4, true };
+    inplace_vector<std::byte, 16> buffer;
+    auto fill = async_fill( buffer, manual );
+    fill.start();
+    int resumes = 0;
+    while ( !fill.done() )
+    {
+      test( manual.pending );
+      std::exchange( manual.pending, {} ).resume();
+      ++resumes;
+    }
+    test( resumes == 4 ); // 4 + 4 + 2 bytes, then end of source
+    test( fill.result() == 10 );
+    test( buffer.size() == 10 );
+    test( buffer[ 9 ] == std::byte{ '9' } );
+  }
+
+  // async_fill(), async_drain() over an overlapped file and an I/O completion port
+  {
+    wchar_t dir[ MAX_PATH ];
+    wchar_t path[ MAX_PATH ];
+    test( GetTempPathW( MAX_PATH, dir ) != 0 );
+    test( GetTempFileNameW( dir, L"ivb", 0, path ) != 0 );
+    HANDLE file = CreateFileW( path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                               FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_OVERLAPPED | FILE_FLAG_DELETE_ON_CLOSE,
+                               nullptr );
+    test( file != INVALID_HANDLE_VALUE );
+    HANDLE port = CreateIoCompletionPort( file, nullptr, 0, 1 );
+    test( port != nullptr );
+
+    inplace_vector<std::byte, 16> out;
+    for ( char c : "overlapped I/O"sv )
+      out.push_back( std::byte( c ) );
+    IocpFile writer{ file };
+    auto drain = async_drain( out, writer );
+    drain.start();
+    RunOnPort( port, drain );
+    test( drain.result() == 14 );
+    test( out.empty() );
+    test( writer.offset == 14 );
+
+    inplace_vector<std::byte, 8> in; // smaller than the file; stops when full
+    IocpFile reader{ file };
+    auto fill = async_fill( in, reader );
+    fill.start();
+    RunOnPort( port, fill );
+    test( fill.result() == 8 );
+    test( in.size() == 8 );
+    test( in[ 0 ] == std::byte{ 'o' } );
+    test( in[ 7 ] == std::byte{ 'p' } );
+
+    in.clear();
+    auto rest = async_fill( in, reader ); // 6 bytes, then end of file
+    rest.start();
+    RunOnPort( port, rest );
+    test( rest.result() == 6 );
+    test( in[ 5 ] == std::byte{ 'O' } );
+
+    CloseHandle( port );
+    CloseHandle( file ); // FILE_FLAG_DELETE_ON_CLOSE removes the file
+  }
+
   // clear(), erase()
   {
     using ivC = inplace_vector<char, 5>;
@@ -948,6 +2630,241 @@ int __cdecl main()
     test( ivm2[ 1 ].getStr() == "y"sv );
   }
 
+  // erase_unordered(), erase_if_unordered()
+  {
+    inplace_vector<char, 5> iv{ 'a', 'b', 'c', 'd', 'e' };
+    test( *iv.erase_unordered( iv.begin() ) == 'e' ); // back() moves into the hole
+    test( iv.size() == 4 );
+    test( iv[ 0 ] == 'e' );
+    test( iv[ 1 ] == 'b' );
+    test( iv[ 3 ] == 'd' );
+    test( iv.erase_unordered( iv.end() - 1 ) == iv.end() ); // erasing back() just pops
+    test( iv.size() == 3 );
+    test( iv[ 2 ] == 'c' );
+
+    using ivM = inplace_vector<M, 5>;
+    const auto init = { M{ "a", 0, 1.0f },
+                        M{ "b", 0, 1.0f },
+                        M{ "c", 0, 1.0f },
+                        M{ "d", 0, 1.0f },
+                        M{ "e", 0, 1.0f } };
+    ivM ivm( init );
+    test( ivm.erase_unordered( ivm.begin() + 1 )->getStr() == "e"sv );
+    test( ivm.size() == 4 );
+    test( ivm[ 1 ] == M( "e", 0, 1.0f ) );
+    test( ivm[ 3 ].getStr() == "d"sv );
+
+    ivm.assign( init );
+    auto isBorD = []( const M& m ) { return m.getStr() == "b"sv || m.getStr() == "d"sv; };
+    test( erase_if_unordered( ivm, isBorD ) == 2 );
+    test( ivm.size() == 3 );
+    test( std::ranges::none_of( ivm, isBorD ) );
+    const auto expected = { M{ "a", 0, 1.0f }, M{ "c", 0, 1.0f }, M{ "e", 0, 1.0f } };
+    test( std::ranges::is_permutation( ivm, expected ) );
+    test( erase_if_unordered( ivm, isBorD ) == 0 );
+
+    ivm.assign( init );
+    test( erase_if_unordered( ivm, []( const M& ) { return true; } ) == 5 );
+    test( ivm.empty() );
+
+    inplace_vector<int, 10> ivI( 10, 0 );
+    std::ranges::iota( ivI, 0 );
+    test( erase_if_unordered( ivI, []( int x ) { return x % 2 == 0; } ) == 5 );
+    test( std::ranges::is_permutation( ivI, std::array{ 1, 3, 5, 7, 9 } ) );
+  }
+
+  // trivially relocatable insert, erase, erase_if, swap
+  {
+    static_assert( is_trivially_relocatable_v<int> );
+    static_assert( is_trivially_relocatable_v<R> );
+    static_assert( !is_trivially_relocatable_v<M> );
+
+    using ivR = inplace_vector<R, 6>;
+    ivR iv{ R{ "a", 1, 1.0f }, R{ "b", 2, 2.0f }, R{ "c", 3, 3.0f }, R{ "d", 4, 4.0f } };
+
+    test( iv.insert( iv.begin() + 1, R{ "x", 5, 5.0f } )->getStr() == "x"sv );
+    test( iv.size() == 5 );
+    test( iv[ 0 ].getStr() == "a"sv );
+    test( iv[ 1 ].getStr() == "x"sv );
+    test( iv[ 2 ].getStr() == "b"sv );
+    test( iv[ 4 ].getStr() == "d"sv );
+    test( iv[ 4 ] == R( "d", 4, 4.0f ) );
+
+    test( iv.insert( iv.begin(), 1, R{} )->getStr() == "Initialized"sv );
+    test( iv.size() == 6 );
+    testex( iv.insert( iv.begin() + 2, R{} ), std::bad_alloc, "bad allocation"sv );
+    test( iv.size() == 6 );
+    test( iv[ 2 ].getStr() == "x"sv );
+
+    test( iv.erase( iv.begin() + 2 )->getStr() == "b"sv );  // erase x
+    test( iv.erase( iv.begin(), iv.begin() + 2 )->getStr() == "b"sv ); // erase Initialized, a
+    test( iv.size() == 3 );
+    test( iv[ 0 ].getStr() == "b"sv );
+    test( iv[ 1 ].getStr() == "c"sv );
+    test( iv[ 2 ] == R( "d", 4, 4.0f ) );
+
+    iv.push_back( R{ "b", 6, 6.0f } );
+    auto count = erase_if( iv, []( const R& r ) { return r.getStr() == "b"sv; } );
+    test( count == 2 );
+    test( iv.size() == 2 );
+    test( iv[ 0 ].getStr() == "c"sv );
+    test( iv[ 1 ].getStr() == "d"sv );
+
+    ivR iv2{ R{ "y", 7, 7.0f } };
+    iv.swap( iv2 );
+    test( iv.size() == 1 );
+    test( iv[ 0 ].getStr() == "y"sv );
+    test( iv2.size() == 2 );
+    test( iv2[ 1 ] == R( "d", 4, 4.0f ) );
+  }
+
+  // special member counts; an extra copy, move or destruction fails here. Shifting
+  // follows std::vector: move-construct into the new end, move-assign the rest.
+  {
+    using ivC = inplace_vector<Counted, 8>;
+    const Counted c{ 9 };
+    const std::array<Counted, 3> src{ Counted{ 1 }, Counted{ 2 }, Counted{ 3 } };
+    Counted::reset();
+
+    {
+      ivC iv;
+      Counted::expect( {} );
+    }
+    Counted::expect( {} );
+
+    {
+      ivC iv( 4 );
+      Counted::expect( { .ctor = 4 } );
+      ivC iv2( 2, c );
+      Counted::expect( { .copyCtor = 2 } );
+    }
+    Counted::expect( { .dtor = 6 } );
+
+    // copy and move ctors; moved-from is left empty
+    {
+      ivC iv( src.begin(), src.end() );
+      Counted::expect( { .copyCtor = 3 } );
+      ivC iv2( iv );
+      Counted::expect( { .copyCtor = 3 } );
+      ivC iv3( std::move( iv ) );
+      Counted::expect( { .moveCtor = 3, .dtor = 3 } );
+      test( iv.empty() );
+    }
+    Counted::expect( { .dtor = 6 } );
+
+    // copy and move assignment reuse live elements
+    {
+      ivC iv( 2 );
+      ivC iv2( src.begin(), src.end() );
+      Counted::reset();
+      iv = iv2;
+      Counted::expect( { .copyCtor = 1, .copyAssign = 2 } );
+      iv.pop_back();
+      Counted::reset();
+      iv2 = std::move( iv );
+      Counted::expect( { .moveAssign = 2, .dtor = 3 } );
+      test( iv.empty() );
+      test( iv2.size() == 2 );
+    }
+    Counted::reset();
+
+    // emplace_back, push_back
+    {
+      ivC iv;
+      iv.emplace_back( 1 );
+      Counted::expect( { .ctor = 1 } );
+      iv.push_back( c );
+      Counted::expect( { .copyCtor = 1 } );
+      iv.push_back( Counted{ 2 } );
+      Counted::expect( { .ctor = 1, .moveCtor = 1, .dtor = 1 } );
+      iv.unchecked_emplace_back( 3 );
+      Counted::expect( { .ctor = 1 } );
+      test( iv.try_emplace_back( 4 ) != nullptr );
+      Counted::expect( { .ctor = 1 } );
+    }
+    Counted::reset();
+
+    // insert, emplace; each shifts the tail once
+    {
+      ivC iv( src.begin(), src.end() );
+      Counted::reset();
+      iv.insert( iv.end(), c );
+      Counted::expect( { .copyCtor = 1 } );
+      iv.insert( iv.begin() + 1, Counted{ 4 } ); // 3 elements after pos
+      Counted::expect( { .ctor = 1, .moveCtor = 1, .moveAssign = 3, .dtor = 1 } );
+      iv.insert( iv.begin(), c ); // 5 after; copied to a temp first in case c aliases
+      Counted::expect( { .copyCtor = 1, .moveCtor = 1, .moveAssign = 5, .dtor = 1 } );
+      iv.emplace( iv.begin() + 4, 5 ); // 2 after
+      Counted::expect( { .ctor = 1, .moveCtor = 1, .moveAssign = 2, .dtor = 1 } );
+      iv.emplace( iv.end(), 6 );
+      Counted::expect( { .ctor = 1 } );
+      test( iv.size() == 8 );
+      testex( iv.emplace( iv.begin(), 7 ), std::bad_alloc, "bad allocation"sv );
+      Counted::expect( {} ); // full; nothing touched
+    }
+    Counted::reset();
+
+    // erase, erase_if
+    {
+      ivC iv{ Counted{ 1 }, Counted{ 2 }, Counted{ 3 }, Counted{ 4 }, Counted{ 5 }, Counted{ 6 } };
+      Counted::reset();
+      iv.erase( iv.begin() + 1 ); // 4 after pos
+      Counted::expect( { .moveAssign = 4, .dtor = 1 } );
+      iv.erase( iv.begin(), iv.begin() + 2 ); // 3 after range
+      Counted::expect( { .moveAssign = 3, .dtor = 2 } );
+      iv.erase( iv.end() - 1 );
+      Counted::expect( { .dtor = 1 } );
+      test( iv.size() == 2 );
+      test( iv[ 0 ].get() == 4 );
+      test( iv[ 1 ].get() == 5 );
+      iv.push_back( Counted{ 6 } );
+      Counted::reset();
+      test( erase_if( iv, []( const Counted& e ) { return e.get() == 4; } ) == 1 );
+      Counted::expect( { .moveAssign = 2, .dtor = 1 } );
+    }
+    Counted::reset();
+
+    // resize
+    {
+      ivC iv;
+      iv.resize( 3 );
+      Counted::expect( { .ctor = 3 } );
+      iv.resize( 5, c );
+      Counted::expect( { .copyCtor = 2 } );
+      iv.resize( 1 );
+      Counted::expect( { .dtor = 4 } );
+      iv.resize( 1 );
+      Counted::expect( {} );
+    }
+    Counted::reset();
+
+    // append_range
+    {
+      ivC iv( 1 );
+      Counted::reset();
+      iv.append_range( src );
+      Counted::expect( { .copyCtor = 3 } );
+      std::vector<Counted> moveSrc( 2 );
+      Counted::reset();
+      iv.append_range( moveSrc | std::views::as_rvalue );
+      Counted::expect( { .moveCtor = 2 } );
+      testex( iv.append_range( src ), std::bad_alloc, "bad allocation"sv );
+    }
+    Counted::reset();
+
+    // swap; common prefix swapped element-wise, the remainder moved across
+    {
+      ivC iv( src.begin(), src.end() );
+      ivC iv2( src.begin(), src.begin() + 2 );
+      Counted::reset();
+      iv.swap( iv2 );
+      Counted::expect( { .moveCtor = 3, .moveAssign = 4, .dtor = 3 } );
+      test( iv.size() == 2 );
+      test( iv2.size() == 3 );
+    }
+    Counted::expect( { .dtor = 5 } );
+  }
+
   // non-member erase and erase_if
   {
     inplace_vector<int, 10> iv( 10, 0 );
@@ -967,6 +2884,58 @@ int __cdecl main()
     test( iv[ 3 ] == 9 );
   }
 
+  // vectorized erase, erase_if and comparison kernels match the scalar path
+  {
+    std::mt19937 rng( 12345 ); // fixed seed keeps failures reproducible
+    TestArithmeticKernels<int>( rng );
+    TestArithmeticKernels<unsigned char>( rng );
+    TestArithmeticKernels<int64_t>( rng );
+    TestArithmeticKernels<float>( rng );
+    TestArithmeticKernels<double>( rng );
+  }
+
+  // parallel algorithms match the serial path
+  {
+    constexpr size_t kLarge = 65536;
+    using ivF = inplace_vector<float, kLarge>;
+    using ivI = inplace_vector<int64_t, kLarge>;
+    auto serial = std::make_unique<ivF>( kLarge, 0.0f ); // too big for the stack
+    std::ranges::iota( *serial, 0.0f );
+    auto parallel = std::make_unique<ivF>( *serial );
+
+    auto byThree = []( float x ) { return static_cast<int>( x ) % 3 == 0; };
+    auto count = erase_if( *serial, byThree );
+    test( par::erase_if( *parallel, byThree ) == count );
+    test( *parallel == *serial ); // stream compaction keeps order
+    test( parallel->size() % 16 != 0 ); // ragged tail across cache lines
+
+    auto scale = []( float x ) { return x * 0.5f + 1.0f; };
+    std::ranges::transform( *serial, serial->begin(), scale );
+    par::transform( *parallel, scale );
+    test( *parallel == *serial );
+
+    std::ranges::shuffle( *parallel, std::mt19937{ 7 } );
+    par::sort( *parallel );
+    test( *parallel == *serial );
+    par::sort( *parallel, std::greater<float>{} );
+    test( std::ranges::is_sorted( *parallel, std::greater<float>{} ) );
+
+    auto ints = std::make_unique<ivI>( kLarge, 0 );
+    std::ranges::iota( *ints, int64_t{ 0 } );
+    const auto sum = std::accumulate( ints->begin(), ints->end(), int64_t{ 0 } );
+    test( par::reduce( *ints, int64_t{ 0 }, std::plus<>{} ) == sum );
+    test( par::reduce( inplace_vector<int64_t, 4>{}, int64_t{ 1 }, std::plus<>{} ) == 1 ); // empty yields init
+
+    auto generated = std::make_unique<ivF>();
+    auto half = []( size_t i ) { return static_cast<float>( i ) * 0.5f; };
+    par::append_n( *generated, kLarge - 5, half );
+    test( generated->size() == kLarge - 5 );
+    for ( size_t i = 0; i < generated->size(); ++i )
+      test( ( *generated )[ i ] == half( i ) );
+    testex( par::append_n( *generated, 6, half ), std::bad_alloc, "bad allocation"sv );
+    test( generated->size() == kLarge - 5 );
+  }
+
   // comparison
   {
     inplace_vector<int, 2> ivA{ {1,2} };
@@ -995,6 +2964,656 @@ int __cdecl main()
     test( ivY <= ivX );
   }
 
+  // std::hash; trivially copyable contents are hashed in one pass
+  {
+    using ivI = inplace_vector<int, 4>;
+    std::hash<ivI> hasher;
+    ivI ivA{ 1, 2, 3 };
+    ivI ivB{ 1, 2, 3, 4 };
+    ivB.pop_back(); // stale element past size() must not be hashed
+    test( ivA == ivB );
+    test( hasher( ivA ) == hasher( ivB ) );
+    test( hasher( ivA ) != hasher( ivI{ 3, 2, 1 } ) );
+    test( hasher( ivI{} ) != hasher( ivI{ 0 } ) ); // length is part of the hash
+    test( hasher( ivI{ 0 } ) != hasher( ivI{ 0, 0 } ) );
+
+    // element-wise for everything else
+    using ivS = inplace_vector<std::string, 4>;
+    std::hash<ivS> hasherS;
+    test( hasherS( ivS{ "a", "bc" } ) == hasherS( ivS{ "a", "bc" } ) );
+    test( hasherS( ivS{ "a", "bc" } ) != hasherS( ivS{ "ab", "c" } ) );
+
+    std::unordered_map<inplace_vector<char, 16>, int> map;
+    map[ { 'k', 'e', 'y' } ] = 1;
+    map[ { 'k', 'e' } ] = 2;
+    test( map.size() == 2 );
+    test( map.at( { 'k', 'e', 'y' } ) == 1 );
+    test( !map.contains( { 'k' } ) );
+  }
+
+  // operator<=> for unsigned byte-like T compares with memcmp
+  {
+    using ivU = inplace_vector<unsigned char, 8>;
+    test( ( ivU{ 0x80 } <=> ivU{ 0x7F } ) == std::strong_ordering::greater ); // unsigned
+    test( ( ivU{ 1, 2 } <=> ivU{ 1, 2, 0 } ) == std::strong_ordering::less ); // prefix
+    test( ( ivU{ 1, 3 } <=> ivU{ 1, 2, 9 } ) == std::strong_ordering::greater );
+    test( ( ivU{} <=> ivU{} ) == std::strong_ordering::equal );
+
+    using ivByte = inplace_vector<std::byte, 4>;
+    test( ivByte{ std::byte{ 0xFF } } > ivByte( { std::byte{ 0x01 }, std::byte{ 0x02 } } ) );
+
+    // matches the element-wise result on random contents with long common prefixes
+    constexpr unsigned char kFill = 0xAA;
+    std::mt19937 rng{ 7 };
+    for ( int i = 0; i < 1000; ++i )
+    {
+      ivU ivA( rng() % 9, kFill );
+      ivU ivB( rng() % 9, kFill );
+      if ( !ivA.empty() )
+        ivA[ rng() % ivA.size() ] = static_cast<unsigned char>( rng() );
+      std::vector<unsigned char> vA( ivA.begin(), ivA.end() );
+      std::vector<unsigned char> vB( ivB.begin(), ivB.end() );
+      test( ( ivA <=> ivB ) == ( vA <=> vB ) );
+      test( ( ivA == ivB ) == ( vA == vB ) );
+    }
+  }
+
+  // instrumentation policy
+  {
+    // disabled by default and free when disabled
+    static_assert( std::is_same_v<inplace_vector<char, 3>, inplace_vector<char, 3, inplace_vector_no_stats>> );
+    static_assert( sizeof( inplace_vector<char, 3, inplace_vector_stats> ) > sizeof( inplace_vector<char, 3> ) );
+
+    {
+      using ivC = inplace_vector<char, 3, inplace_vector_stats>;
+      ivC iv;
+      test( iv.stats().peak_size == 0 );
+      test( iv.push_back( 'a' ) == 'a' );
+      test( iv.push_back( 'b' ) == 'b' );
+      iv.pop_back();
+      test( iv.stats().peak_size == 2 );
+      test( iv.push_back( 'b' ) == 'b' );
+      test( iv.push_back( 'c' ) == 'c' );
+      test( iv.stats().peak_size == 3 );
+
+      test( iv.try_push_back( 'd' ) == nullptr );
+      test( iv.try_emplace_back( 'd' ) == nullptr );
+      test( iv.stats().try_failures == 2 );
+      test( iv.stats().bad_alloc_throws == 0 );
+      testex( iv.push_back( 'f' ), std::bad_alloc, "bad allocation"sv );
+      test( iv.stats().bad_alloc_throws == 1 );
+    } // destruction publishes the counters to the registry
+
+    const auto init = { 1, 2, 3 };
+    inplace_vector<int, 4, inplace_vector_stats> iv( init );
+    test( iv.stats().peak_size == 3 );
+    test( iv.try_append_range( init ) == std::ranges::begin( init ) + 1 ); // partial fit fails
+    test( iv.stats().try_failures == 1 );
+    test( iv.stats().peak_size == 4 );
+    test( iv.try_append_range( init ) == std::ranges::begin( init ) );
+    test( iv.stats().try_failures == 2 );
+    const std::vector<int> emptyRange;
+    test( iv.try_append_range( emptyRange ) == std::ranges::end( emptyRange ) );
+    test( iv.stats().try_failures == 2 );
+
+    auto& registry = inplace_vector_registry::instance();
+    auto counters = registry.find( typeid( char ), 3 );
+    test( counters.peak_size == 3 );
+    test( counters.try_failures == 2 );
+    test( counters.bad_alloc_throws == 1 );
+    test( registry.find( typeid( char ), 4 ).peak_size == 0 ); // never instantiated
+
+    registry.publish( iv ); // live instances can be scraped without being destroyed
+    test( registry.find( typeid( int ), 4 ).peak_size == 4 );
+    std::ostringstream dump;
+    registry.dump( dump );
+    test( dump.str().find( typeid( char ).name() ) != std::string::npos );
+    test( dump.str().find( typeid( int ).name() ) != std::string::npos );
+  }
+
+  // tracing policy; mutating operations report the elements they moved, constructed or
+  // destroyed to a sink, timed by a scope timer
+  {
+    // no per-object state, so tracing never changes the layout
+    static_assert( sizeof( inplace_vector<char, 3, inplace_vector_trace<RecordingSink>> ) ==
+                   sizeof( inplace_vector<char, 3> ) );
+
+    using ivT = inplace_vector<int, 8, inplace_vector_trace<RecordingSink>>;
+    using Op = inplace_trace_op;
+    auto& events = RecordingSink::events;
+    auto last = [&]( Op op, size_t elements )
+      {
+        return !events.empty() && events.back().op == op && events.back().elements == elements;
+      };
+
+    ivT iv{ 1, 2, 3, 4 };
+    events.clear();
+    iv.insert( iv.begin() + 1, 9 ); // shifts 3, constructs 1
+    test( last( Op::insert, 4 ) );
+    iv.erase( iv.begin() ); // shifts 4, destroys 1
+    test( last( Op::erase, 5 ) );
+    const auto init = { 5, 6 };
+    iv.append_range( init );
+    test( last( Op::append_range, 2 ) );
+    test( erase_if( iv, []( int i ) { return i % 2 == 0; } ) == 3 ); // { 9,2,3,4,5,6 }
+    test( last( Op::erase_if, 5 ) ); // 2 compacted, 3 destroyed
+    iv.resize( 6 );
+    test( last( Op::resize, 3 ) );
+    iv.resize( 6 );
+    test( last( Op::resize, 0 ) );
+    ivT iv2{ 7 };
+    iv.swap( iv2 );
+    test( last( Op::swap, 6 ) );
+    test( events.size() == 7 );
+
+    // non-mutating and non-traced operations report nothing
+    events.clear();
+    test( iv.size() == 1 );
+    test( iv2.front() == 9 );
+    iv.push_back( 1 );
+    test( events.empty() );
+
+    // a failed operation reports nothing
+    testex( iv.insert( iv.begin(), 7, 0 ), std::bad_alloc, "bad allocation"sv );
+    test( events.empty() );
+
+    // in-memory histogram sink buckets elapsed time by power of two nanoseconds
+    auto& histogram = inplace_trace_histogram::instance();
+    histogram.reset();
+    using ivH = inplace_vector<int, 8, inplace_vector_trace<inplace_trace_histogram>>;
+    ivH ivh{ 1, 2, 3 };
+    ivh.insert( ivh.begin(), 0 );
+    ivh.insert( ivh.end(), 4 );
+    ivh.erase( ivh.begin() );
+    test( histogram.count( Op::insert ) == 2 );
+    test( histogram.count( Op::erase ) == 1 );
+    test( histogram.count( Op::swap ) == 0 );
+    test( histogram.elements( Op::insert ) == 5 );
+    std::ostringstream dump;
+    histogram.dump( dump );
+    test( dump.str().find( "insert" ) != std::string::npos );
+    test( dump.str().find( "erase" ) != std::string::npos );
+    histogram.reset();
+    test( histogram.count( Op::insert ) == 0 );
+
+    // ETW events go nowhere without a listening session; behaviour is unchanged
+    using ivE = inplace_vector<int, 8, inplace_vector_trace<inplace_trace_etw>>;
+    ivE ive{ 1, 2, 3 };
+    ive.insert( ive.begin(), 0 );
+    ive.erase( ive.end() - 1 );
+    test( ive == ivE( { 0, 1, 2 } ) );
+
+    // policies compose; stats and tracing together, and with an Align parameter
+    using Both = inplace_vector_policies<inplace_vector_stats, inplace_vector_trace<RecordingSink>>;
+    static_assert( std::is_same_v<inplace_vector_policies<inplace_vector_no_stats>, inplace_vector_no_stats> );
+    static_assert( sizeof( inplace_vector<char, 3, Both> ) == sizeof( inplace_vector<char, 3, inplace_vector_stats> ) );
+    using ivBoth = inplace_vector<int, 8, Both, 64>;
+    static_assert( alignof( ivBoth ) == 64 );
+    events.clear();
+    ivBoth ivb{ 1, 2 };
+    ivb.insert( ivb.begin(), 0 );
+    test( last( Op::insert, 3 ) );
+    test( ivb.stats().peak_size == 3 );
+    test( ivb.try_push_back( 9 ) != nullptr );
+    test( ivb.stats().peak_size == 4 );
+    test( reinterpret_cast<uintptr_t>( ivb.data() ) % 64 == 0 );
+    testex( ivb.append_range( std::array{ 1, 2, 3, 4, 5 } ), std::bad_alloc, "bad allocation"sv );
+    test( ivb.stats().bad_alloc_throws == 1 );
+    test( events.size() == 1 ); // the failed append_range reports nothing
+
+#if defined( TRACY_ENABLE )
+    using ivZ = inplace_vector<int, 8, inplace_vector_trace<inplace_trace_tracy>>;
+    ivZ ivz{ 1, 2, 3 };
+    ivz.insert( ivz.begin(), 0 );
+    test( ivz.size() == 4 );
+#endif
+  }
+
+  // inplace_vector_pool
+  {
+    inplace_vector_pool<M, 4> pool( 3 );
+    test( pool.capacity() == 3 );
+    test( pool.available() == 3 );
+
+    auto* a = pool.acquire();
+    auto* b = pool.acquire();
+    test( a != nullptr );
+    test( b != nullptr );
+    test( a != b );
+    test( a->empty() );
+    test( a->capacity() == 4 );
+    test( reinterpret_cast<uintptr_t>( a ) % 64 == 0 ); // cache-line aligned slots
+    test( reinterpret_cast<uintptr_t>( b ) % 64 == 0 );
+    test( pool.available() == 1 );
+
+    a->push_back( M{ "a", 1, 1.0f } );
+    test( ( *a )[ 0 ].getStr() == "a"sv );
+
+    auto* c = pool.acquire();
+    test( pool.available() == 0 );
+    test( pool.try_acquire() == nullptr );
+    testex( pool.acquire(), std::bad_alloc, "bad allocation"sv );
+
+    pool.release( a ); // contents destroyed; slot is reused first
+    test( pool.available() == 1 );
+    auto* d = pool.try_acquire();
+    test( d == a );
+    test( d->empty() );
+
+    pool.release( b );
+    pool.release( c );
+    pool.release( d );
+    test( pool.available() == 3 );
+  }
+
+  // small_vector mirrors the suite above
+  {
+    TestSmallVector();
+  }
+
+  // inplace_spsc_ring
+  {
+    inplace_spsc_ring<M, 4> ring;
+    test( ring.empty() );
+    test( ring.capacity() == 4 );
+    test( !ring.try_pop() ); // empty
+
+    test( ring.try_push( M{ "a", 1, 1.0f } ) );
+    const auto init = { M{ "b", 2, 2.0f }, M{ "c", 3, 3.0f }, M{ "d", 4, 4.0f }, M{ "e", 5, 5.0f } };
+    test( ring.try_push_range( init ) == std::ranges::begin( init ) + 3 ); // e does not fit
+    test( ring.size() == 4 );
+    test( !ring.try_push( M{} ) ); // full
+
+    auto a = ring.try_pop();
+    test( a && a->getStr() == "a"sv );
+    inplace_vector<M, 2> batch;
+    test( ring.try_pop_into( batch ) == 2 ); // stops at batch capacity
+    test( batch[ 0 ].getStr() == "b"sv );
+    test( batch[ 1 ].getStr() == "c"sv );
+    test( ring.try_pop_into( batch ) == 0 ); // batch full
+
+    test( ring.try_push_range( init ) == std::ranges::begin( init ) + 3 ); // wraps around
+    inplace_vector<M, 8> rest;
+    test( ring.try_pop_into( rest ) == 4 );
+    test( rest[ 0 ].getStr() == "d"sv );
+    test( rest[ 3 ].getStr() == "d"sv );
+    test( ring.empty() );
+
+    // two-thread stress; the consumer checks that every value arrives once, in order
+    constexpr int kCount = 1'000'000;
+    inplace_spsc_ring<int, 64> intRing;
+    std::thread producer( [&intRing]()
+      {
+        std::array<int, 37> values{}; // odd batch size exercises every wrap offset
+        for ( int next = 0; next < kCount; )
+        {
+          auto count = std::min( static_cast<int>( values.size() ), kCount - next );
+          std::iota( values.begin(), values.begin() + count, next );
+          auto first = values.begin();
+          auto last = values.begin() + count;
+          while ( first != last )
+            first = intRing.try_push_range( std::ranges::subrange( first, last ) );
+          next += count;
+        }
+      } );
+
+    int expected = 0;
+    bool inOrder = true;
+    inplace_vector<int, 50> received;
+    while ( expected < kCount )
+    {
+      received.clear();
+      intRing.try_pop_into( received );
+      for ( int value : received )
+        inOrder = inOrder && ( value == expected++ );
+    }
+    producer.join();
+    test( inOrder );
+    test( intRing.empty() );
+  }
+
+  // inplace_flat_set
+  {
+    inplace_flat_set<int, 4> set;
+    test( set.empty() );
+    test( set.capacity() == 4 );
+    test( set.insert( 3 ).second );
+    test( set.insert( 1 ).second );
+    test( !set.insert( 3 ).second ); // duplicate
+    test( *set.try_insert( 2 ) == 2 );
+    test( std::ranges::equal( set, std::array{ 1, 2, 3 } ) ); // kept sorted
+    test( set.contains( 2 ) );
+    test( !set.contains( 4 ) );
+    test( set.count( 1 ) == 1 );
+    test( set.find( 4 ) == set.end() );
+    test( *set.lower_bound( 0 ) == 1 );
+
+    test( set.insert( 0 ).second );
+    test( set.size() == 4 );
+    test( set.try_insert( 9 ) == nullptr ); // full
+    test( *set.try_insert( 0 ) == 0 ); // already present, so no room is needed
+    testex( set.insert( 9 ), std::bad_alloc, "bad allocation"sv );
+    test( set.erase( 2 ) == 1 );
+    test( set.erase( 2 ) == 0 );
+    test( std::ranges::equal( set, std::array{ 0, 1, 3 } ) );
+
+    // insert_range sorts the input and merges once
+    inplace_flat_set<int, 8, std::greater<int>> desc{ 5, 1 };
+    desc.insert_range( std::array{ 4, 9, 1, 4, 7 } );
+    test( std::ranges::equal( desc, std::array{ 9, 7, 5, 4, 1 } ) );
+    testex( desc.insert_range( std::array{ 2, 3, 6, 8 } ), std::bad_alloc, "bad allocation"sv );
+    test( desc.size() == 5 ); // strong guarantee
+  }
+
+  // inplace_flat_map
+  {
+    using Map = inplace_flat_map<std::string, M, 3>;
+    Map map;
+    test( map.insert( { "b"s, M{ "b", 2, 2.0f } } ).second );
+    test( map.insert( { "a"s, M{ "a", 1, 1.0f } } ).second );
+    test( !map.insert( { "a"s, M{} } ).second );
+    test( map.at( "a" ).getStr() == "a"sv );
+    test( map[ "c" ] == M{} ); // operator[] default constructs
+    test( map.size() == 3 );
+    test( map.try_insert( "d", M{} ) == nullptr ); // full
+    test( map.try_insert( "c", M{ "x", 0, 0.0f } )->getStr() == "Initialized"sv ); // present
+    testex( map[ "d" ], std::bad_alloc, "bad allocation"sv );
+    testex( map.at( "d" ), std::out_of_range&, "inplace_flat_map::at"sv );
+
+    // keys and values are stored in separate contiguous arrays
+    std::span<const std::string> keys = map.keys();
+    std::span<M> values = map.values();
+    test( std::ranges::equal( keys, std::array{ "a"s, "b"s, "c"s } ) );
+    test( values[ 1 ].getStr() == "b"sv );
+    test( map.contains( "b" ) );
+    test( map.erase( "b" ) == 1 );
+    test( !map.contains( "b" ) );
+    test( map.values()[ 1 ] == M{} );
+    test( map.find( "z" ) == map.end() );
+
+    inplace_flat_map<int, int, 8> ints;
+    ints.insert_range( std::array{ std::pair{ 3, 30 }, std::pair{ 1, 10 }, std::pair{ 2, 20 } } );
+    test( std::ranges::equal( ints.keys(), std::array{ 1, 2, 3 } ) );
+    test( std::ranges::equal( ints.values(), std::array{ 10, 20, 30 } ) );
+  }
+
+  // inplace_mpmc_queue
+  {
+    using Batch = inplace_vector<M, 3>;
+    inplace_mpmc_queue<Batch, 4> queue;
+    test( queue.capacity() == 4 );
+
+    Batch out;
+    test( !queue.try_pop( out ) ); // empty
+    Batch batch{ M{ "a", 1, 1.0f }, M{ "b", 2, 2.0f } };
+    test( queue.try_push( batch ) ); // copy
+    test( queue.try_push( Batch{ M{ "c", 3, 3.0f } } ) ); // move
+    test( queue.try_push( Batch{} ) );
+    test( queue.try_push( batch ) );
+    test( !queue.try_push( batch ) ); // full
+
+    test( queue.try_pop( out ) ); // FIFO
+    test( out == batch );
+    test( queue.try_pop( out ) );
+    test( out.size() == 1 );
+    test( out[ 0 ].getStr() == "c"sv );
+    test( queue.try_pop( out ) );
+    test( out.empty() );
+    test( queue.try_push( batch ) ); // slot reused after wrap
+    test( queue.try_pop( out ) );
+    test( queue.try_pop( out ) );
+    test( out == batch );
+    test( !queue.try_pop( out ) );
+
+    // 4 producers and 4 consumers; every item must be delivered exactly once
+    using IntBatch = inplace_vector<int, 16>;
+    constexpr int kThreads = 4;
+    constexpr int kBatchesPerProducer = 20'000;
+    constexpr int kItems = kThreads * kBatchesPerProducer * 16;
+    inplace_mpmc_queue<IntBatch, 64> intQueue;
+    std::atomic<int> received = 0;
+    std::atomic<int64_t> sum = 0;
+    std::vector<std::thread> threads;
+    for ( int t = 0; t < kThreads; ++t )
+    {
+      threads.emplace_back( [&intQueue, t]()
+        {
+          IntBatch values( 16 );
+          for ( int b = 0; b < kBatchesPerProducer; ++b )
+          {
+            std::iota( values.begin(), values.end(), ( t * kBatchesPerProducer + b ) * 16 );
+            while ( !intQueue.try_push( values ) )
+              std::this_thread::yield();
+          }
+        } );
+      threads.emplace_back( [&intQueue, &received, &sum]()
+        {
+          IntBatch values;
+          while ( received.load() < kItems )
+          {
+            if ( !intQueue.try_pop( values ) )
+            {
+              std::this_thread::yield();
+              continue;
+            }
+            sum += std::accumulate( values.begin(), values.end(), int64_t{ 0 } );
+            received += static_cast<int>( values.size() );
+          }
+        } );
+    }
+    for ( auto& thread : threads )
+      thread.join();
+    test( received == kItems );
+    test( sum == int64_t{ kItems } * ( kItems - 1 ) / 2 );
+  }
+
+  // inplace_soa_vector
+  {
+    using Soa = inplace_soa_vector<3, float, int, std::string>;
+    Soa soa;
+    test( soa.empty() );
+    test( soa.capacity() == 3 );
+
+    auto [x, id, name] = soa.push_back( 1.0f, 10, "a" );
+    test( x == 1.0f );
+    test( id == 10 );
+    test( name == "a"sv );
+    std::get<1>( soa.emplace_back( 2.0f, 20, "b" ) ) = 21;
+    // like inplace_vector's try_ family, a row pointer on success and nullptr when full;
+    // a row spans the columns, so the pointer is a proxy that dereferences to the tuple
+    static_assert( std::is_same_v<decltype( soa.try_push_back( 0.0f, 0, "" ) ), Soa::pointer> );
+    const auto row = soa.try_push_back( 3.0f, 30, "c" );
+    test( row != nullptr );
+    test( std::get<1>( *row ) == 30 );
+    test( soa.try_push_back( 4.0f, 40, "d" ) == nullptr ); // full
+    testex( soa.push_back( 4.0f, 40, "d" ), std::bad_alloc, "bad allocation"sv );
+    test( soa.size() == 3 );
+
+    // each column is contiguous and shares size()
+    std::span<float> xs = soa.column<0>();
+    std::span<const int> ids = std::as_const( soa ).column<1>();
+    test( xs.size() == 3 );
+    test( ids.size() == 3 );
+    test( ids[ 1 ] == 21 );
+    test( &xs[ 1 ] == &xs[ 0 ] + 1 );
+    test( std::get<2>( soa[ 2 ] ) == "c"sv );
+
+    // zip view
+    int idSum = 0;
+    for ( auto [px, pid, pname] : soa )
+    {
+      px *= 2.0f;
+      idSum += pid;
+      test( pname.size() == 1 );
+    }
+    test( idSum == 10 + 21 + 30 );
+    test( soa.column<0>()[ 2 ] == 6.0f );
+
+    test( std::get<2>( *soa.erase( soa.begin() ) ) == "b"sv );
+    test( soa.size() == 2 );
+    test( soa.column<1>()[ 0 ] == 21 );
+    test( soa.column<2>()[ 1 ] == "c"sv );
+
+    soa.unchecked_push_back( 5.0f, 50, "e" );
+    auto count = erase_if( soa, []( float, int pid, const std::string& ) { return pid > 25; } );
+    test( count == 2 );
+    test( soa.size() == 1 );
+    test( std::get<2>( soa[ 0 ] ) == "b"sv );
+    soa.pop_back();
+    test( soa.empty() );
+  }
+
+  // inplace_slot_vector
+  {
+    using svM = inplace_slot_vector<M, 8>;
+    svM sv;
+    test( sv.empty() );
+    test( sv.capacity() == 8 );
+    const auto a = sv.insert( M{ "a", 1, 1.0f } );
+    const auto b = sv.insert( M{ "b", 2, 2.0f } );
+    const auto c = sv.emplace( "c", 3, 3.0f );
+    const auto d = sv.insert( M{ "d", 4, 4.0f } );
+    test( a == 0 && b == 1 && c == 2 && d == 3 );
+    test( sv.size() == 4 );
+
+    // erase leaves a tombstone; other slots keep their index
+    sv.erase( b );
+    test( sv.size() == 3 );
+    test( sv.tombstones() == 1 );
+    test( !sv.contains( b ) );
+    test( sv.contains( c ) );
+    test( sv[ c ].getStr() == "c"sv );
+    test( sv.at( d ).getStr() == "d"sv );
+    testex( sv.at( b ), std::out_of_range&, "inplace_slot_vector::at"sv );
+    testex( sv.at( 7 ), std::out_of_range&, "inplace_slot_vector::at"sv );
+
+    // iteration is in slot order and skips holes
+    auto strs = [&]()
+      {
+        std::string s;
+        for ( const auto& m : sv )
+          s += m.getStr();
+        return s;
+      };
+    test( strs() == "acd"sv );
+
+    // insertion reuses the lowest free slot
+    const auto e = sv.insert( M{ "e", 5, 5.0f } );
+    test( e == b );
+    test( sv.tombstones() == 0 );
+    test( strs() == "aecd"sv );
+    auto it = sv.begin();
+    ++it;
+    test( it.slot() == e );
+
+    // compaction closes holes in order and reports every move
+    sv.erase( a );
+    sv.erase( c );
+    std::vector<std::pair<size_t, size_t>> moves;
+    sv.compact( [&]( size_t from, size_t to ) { moves.emplace_back( from, to ); } );
+    const std::vector<std::pair<size_t, size_t>> expectedMoves{ { 1, 0 }, { 3, 1 } };
+    test( moves == expectedMoves );
+    test( sv.tombstones() == 0 );
+    test( sv[ 0 ].getStr() == "e"sv );
+    test( sv[ 1 ].getStr() == "d"sv );
+
+    while ( sv.size() < sv.capacity() )
+      sv.insert( M{} );
+    test( sv.try_insert( M{} ) == nullptr );
+    testex( sv.insert( M{} ), std::bad_alloc, "bad allocation"sv );
+    sv.clear();
+    test( sv.empty() );
+    test( sv.begin() == sv.end() );
+
+    // erase destroys in place; nothing shifts
+    inplace_slot_vector<Counted, 8> svC;
+    for ( int i = 0; i < 6; ++i )
+      svC.emplace( i );
+    Counted::reset();
+    svC.erase( 2 );
+    Counted::expect( { .dtor = 1 } );
+    svC.erase( 0 );
+    svC.erase( 4 );
+    Counted::reset();
+    svC.compact(); // slots 1, 3, 5 relocate to 0, 1, 2
+    Counted::expect( { .moveCtor = 3, .dtor = 3 } );
+    test( svC[ 2 ].get() == 5 );
+
+    // lazy compaction once tombstones reach CompactPercent of the occupied span
+    inplace_slot_vector<int, 16, 25> svI;
+    for ( int i = 0; i < 8; ++i )
+      svI.insert( i );
+    svI.erase( 3 );
+    test( !svI.compact_if_sparse() ); // 1 of 8
+    svI.erase( 5 );
+    test( svI.compact_if_sparse() ); // 2 of 8
+    test( svI.tombstones() == 0 );
+    test( std::ranges::equal( svI, std::array{ 0, 1, 2, 4, 6, 7 } ) );
+
+    // iteration across several bitset words
+    inplace_slot_vector<int, 200> svW;
+    for ( int i = 0; i < 200; ++i )
+      svW.insert( i );
+    for ( size_t slot = 0; slot < 200; ++slot )
+      if ( slot % 7 != 0 )
+        svW.erase( slot );
+    test( svW.size() == 29 );
+    size_t expectedSlot = 0;
+    for ( auto w = svW.begin(); w != svW.end(); ++w, expectedSlot += 7 )
+    {
+      test( w.slot() == expectedSlot );
+      test( *w == static_cast<int>( expectedSlot ) );
+    }
+    test( expectedSlot == 203 );
+  }
+
+  // shared_inplace_vector
+  {
+    using Shared = shared_inplace_vector<int, 16>;
+    const auto name = "/TestInplaceVector.shared."s + std::to_string( _getpid() ); // unique per run
+    // attach() reports a missing mapping with a plain runtime_error, like a layout mismatch;
+    // a system_error would append the OS message to what()
+    testex( Shared::attach( name ), std::runtime_error&, "shared_inplace_vector::attach: not found"sv );
+
+    auto writer = Shared::create( name ); // constructs an empty inplace_vector in the mapping
+    auto reader = Shared::attach( name );
+    test( reader.snapshot().empty() );
+    writer.write( []( inplace_vector<int, 16>& iv ) { iv.append_range( std::array{ 1, 2, 3 } ); } );
+    const auto snap = reader.snapshot();
+    test( snap.size() == 3 );
+    test( snap[ 2 ] == 3 );
+    test( reader.get().size() == 3 ); // both handles map the same memory
+    test( std::ranges::equal( reader.get(), writer.get() ) );
+
+    // the header's magic, version, element size and capacity must match
+    testex( ( shared_inplace_vector<int, 8>::attach( name ) ), std::runtime_error&,
+            "shared_inplace_vector::attach: layout mismatch"sv );
+    testex( ( shared_inplace_vector<float, 16>::attach( name ) ), std::runtime_error&,
+            "shared_inplace_vector::attach: layout mismatch"sv );
+
+    // seqlock; readers never observe a half-written update
+    writer.write( []( inplace_vector<int, 16>& iv ) { iv.assign( 16, -1 ); } );
+    std::atomic<bool> done = false;
+    std::thread writerThread( [&]()
+      {
+        for ( int value = 0; value < 20'000; ++value )
+          writer.write( [value]( inplace_vector<int, 16>& iv ) { iv.assign( 16, value ); } );
+        done = true;
+      } );
+    bool consistent = true;
+    while ( !done )
+    {
+      const auto view = reader.snapshot();
+      consistent = consistent && std::ranges::all_of( view, [&]( int x ) { return x == view.front(); } );
+    }
+    writerThread.join();
+    test( consistent );
+    const inplace_vector<int, 16> last( 16, 19'999 );
+    test( reader.snapshot() == last );
+
+    Shared::remove( name ); // drops the name; mapped handles stay valid until destroyed
+  }
+
   // test code from cppreference.com
   {
     inplace_vector<int, 4> v1{ 0, 1, 2 };